@@ -0,0 +1,83 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Measures basic_mempool::MemPool allocation throughput as the number of
+// threads grows, with and without the per-thread size class caches.
+// Each thread keeps a small window of live temporaries of mixed sizes.
+//
+
+#include <omp.h>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+#define ALLOCS_PER_THREAD 10000
+#define WINDOW 16
+
+using pool_type =
+    RAJA::basic_mempool::MemPool<RAJA::basic_mempool::generic_allocator>;
+
+static void benchmark_mempool(benchmark::State& state, bool thread_caches)
+{
+  const int num_threads = static_cast<int>(state.range(0));
+
+  pool_type pool;
+  pool.thread_caches(thread_caches);
+
+  while (state.KeepRunning()) {
+#pragma omp parallel num_threads(num_threads)
+    {
+      double* live[WINDOW] = {};
+      size_t seed = static_cast<size_t>(omp_get_thread_num()) + 1;
+      for (int i = 0; i < ALLOCS_PER_THREAD; ++i) {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        const size_t len = 1 + ((seed >> 33) % 256);
+        double*& slot = live[i % WINDOW];
+        if (slot != nullptr) {
+          pool.free(slot);
+        }
+        slot = pool.malloc<double>(len);
+        benchmark::DoNotOptimize(slot);
+      }
+      for (double* ptr : live) {
+        if (ptr != nullptr) {
+          pool.free(ptr);
+        }
+      }
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * num_threads * ALLOCS_PER_THREAD);
+
+  pool.free_chunks();
+}
+
+static void benchmark_mempool_locked(benchmark::State& state)
+{
+  benchmark_mempool(state, false);
+}
+
+static void benchmark_mempool_thread_caches(benchmark::State& state)
+{
+  benchmark_mempool(state, true);
+}
+
+static void thread_counts(benchmark::internal::Benchmark* b)
+{
+  const int max_threads = omp_get_max_threads();
+  for (int t = 1; t < max_threads; t *= 2) {
+    b->Arg(t);
+  }
+  b->Arg(max_threads);
+}
+
+BENCHMARK(benchmark_mempool_locked)->Apply(thread_counts)->UseRealTime();
+BENCHMARK(benchmark_mempool_thread_caches)->Apply(thread_counts)->UseRealTime();
+
+BENCHMARK_MAIN();
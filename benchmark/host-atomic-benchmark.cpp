@@ -0,0 +1,124 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Host atomics for each pair of execution and atomic policy. The benchmark
+// argument is the number of histogram bins, so few bins means contention.
+//
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+#define N (1 << 20)
+
+static void bin_counts(benchmark::internal::Benchmark* b)
+{
+  b->Arg(16);
+  b->Arg(1 << 16);
+}
+
+template <typename EXEC_POLICY, typename ATOMIC_POLICY>
+static void benchmark_atomic_add(benchmark::State& state)
+{
+  const int num_bins = static_cast<int>(state.range(0));
+  std::vector<double> bins(num_bins, 0.0);
+  double* pbins = bins.data();
+
+  while (state.KeepRunning()) {
+    RAJA::forall<EXEC_POLICY>(RAJA::TypedRangeSegment<int>(0, N),
+                              [=](int i) {
+                                RAJA::atomicAdd<ATOMIC_POLICY>(
+                                    pbins + (i * 7919L) % num_bins, 1.0);
+                              });
+    benchmark::DoNotOptimize(pbins[0]);
+  }
+
+  state.SetItemsProcessed(state.iterations() * N);
+}
+
+template <typename EXEC_POLICY, typename ATOMIC_POLICY>
+static void benchmark_atomic_max(benchmark::State& state)
+{
+  const int num_bins = static_cast<int>(state.range(0));
+  std::vector<int> bins(num_bins, 0);
+  int* pbins = bins.data();
+
+  while (state.KeepRunning()) {
+    RAJA::forall<EXEC_POLICY>(RAJA::TypedRangeSegment<int>(0, N),
+                              [=](int i) {
+                                RAJA::atomicMax<ATOMIC_POLICY>(
+                                    pbins + (i * 7919L) % num_bins, i);
+                              });
+    benchmark::DoNotOptimize(pbins[0]);
+  }
+
+  state.SetItemsProcessed(state.iterations() * N);
+}
+
+BENCHMARK_TEMPLATE2(benchmark_atomic_add, RAJA::seq_exec, RAJA::seq_atomic)
+    ->Apply(bin_counts);
+BENCHMARK_TEMPLATE2(benchmark_atomic_add, RAJA::loop_exec, RAJA::auto_atomic)
+    ->Apply(bin_counts);
+BENCHMARK_TEMPLATE2(benchmark_atomic_add,
+                    RAJA::loop_exec,
+                    RAJA::builtin_atomic)
+    ->Apply(bin_counts);
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE2(benchmark_atomic_add,
+                    RAJA::omp_parallel_for_exec,
+                    RAJA::omp_atomic)
+    ->Apply(bin_counts)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE2(benchmark_atomic_add,
+                    RAJA::omp_parallel_for_exec,
+                    RAJA::builtin_atomic)
+    ->Apply(bin_counts)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE2(benchmark_atomic_add,
+                    RAJA::omp_parallel_for_exec,
+                    RAJA::auto_atomic)
+    ->Apply(bin_counts)
+    ->UseRealTime();
+#endif
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE2(benchmark_atomic_add,
+                    RAJA::tbb_for_exec,
+                    RAJA::builtin_atomic)
+    ->Apply(bin_counts)
+    ->UseRealTime();
+#endif
+
+BENCHMARK_TEMPLATE2(benchmark_atomic_max, RAJA::seq_exec, RAJA::seq_atomic)
+    ->Apply(bin_counts);
+BENCHMARK_TEMPLATE2(benchmark_atomic_max,
+                    RAJA::loop_exec,
+                    RAJA::builtin_atomic)
+    ->Apply(bin_counts);
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE2(benchmark_atomic_max,
+                    RAJA::omp_parallel_for_exec,
+                    RAJA::omp_atomic)
+    ->Apply(bin_counts)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE2(benchmark_atomic_max,
+                    RAJA::omp_parallel_for_exec,
+                    RAJA::builtin_atomic)
+    ->Apply(bin_counts)
+    ->UseRealTime();
+#endif
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE2(benchmark_atomic_max,
+                    RAJA::tbb_for_exec,
+                    RAJA::builtin_atomic)
+    ->Apply(bin_counts)
+    ->UseRealTime();
+#endif
+
+BENCHMARK_MAIN();
@@ -0,0 +1,290 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Host forall over range, strided range and list segments and over index
+// sets mixing them, for each host execution policy.
+//
+
+#include <algorithm>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+static void problem_sizes(benchmark::internal::Benchmark* b)
+{
+  b->Arg(1 << 12);
+  b->Arg(1 << 20);
+}
+
+template <typename EXEC_POLICY>
+static void benchmark_forall_range(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  std::vector<double> a(n, 1.0), b(n, 2.0);
+  double* pa = a.data();
+  const double* pb = b.data();
+
+  while (state.KeepRunning()) {
+    RAJA::forall<EXEC_POLICY>(RAJA::TypedRangeSegment<int>(0, n),
+                              [=](int i) { pa[i] += 0.5 * pb[i]; });
+    benchmark::DoNotOptimize(pa[0]);
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename EXEC_POLICY>
+static void benchmark_forall_range_stride(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  std::vector<double> a(2 * n, 1.0), b(2 * n, 2.0);
+  double* pa = a.data();
+  const double* pb = b.data();
+
+  while (state.KeepRunning()) {
+    RAJA::forall<EXEC_POLICY>(RAJA::TypedRangeStrideSegment<int>(0, 2 * n, 2),
+                              [=](int i) { pa[i] += 0.5 * pb[i]; });
+    benchmark::DoNotOptimize(pa[0]);
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename EXEC_POLICY>
+static void benchmark_forall_list(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  std::vector<double> a(2 * n, 1.0), b(2 * n, 2.0);
+  double* pa = a.data();
+  const double* pb = b.data();
+
+  // every other index, in blocks visited in reverse order
+  std::vector<int> indices;
+  indices.reserve(n);
+  for (int blk = (n - 1) / 64; blk >= 0; --blk) {
+    for (int i = blk * 64; i < std::min(n, (blk + 1) * 64); ++i) {
+      indices.push_back(2 * i);
+    }
+  }
+  camp::resources::Resource host_res{camp::resources::Host()};
+  RAJA::TypedListSegment<int> list(indices, host_res);
+
+  while (state.KeepRunning()) {
+    RAJA::forall<EXEC_POLICY>(list, [=](int i) { pa[i] += 0.5 * pb[i]; });
+    benchmark::DoNotOptimize(pa[0]);
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename SEG_EXEC_POLICY>
+static void benchmark_forall_indexset(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  std::vector<double> a(n, 1.0), b(n, 2.0);
+  double* pa = a.data();
+  const double* pb = b.data();
+
+  // alternating blocks of ranges, strided ranges and lists
+  using RangeSegType = RAJA::TypedRangeSegment<int>;
+  using RangeStrideSegType = RAJA::TypedRangeStrideSegment<int>;
+  using ListSegType = RAJA::TypedListSegment<int>;
+  RAJA::TypedIndexSet<RangeSegType, RangeStrideSegType, ListSegType> iset;
+
+  camp::resources::Resource host_res{camp::resources::Host()};
+  const int block = 1024;
+  for (int begin = 0, kind = 0; begin < n; begin += block, ++kind) {
+    const int end = std::min(n, begin + block);
+    if (kind % 3 == 0) {
+      iset.push_back(RangeSegType(begin, end));
+    } else if (kind % 3 == 1) {
+      iset.push_back(RangeStrideSegType(begin, end, 1));
+    } else {
+      std::vector<int> indices;
+      for (int i = begin; i < end; ++i) {
+        indices.push_back(i);
+      }
+      iset.push_back(ListSegType(indices, host_res));
+    }
+  }
+
+  while (state.KeepRunning()) {
+    RAJA::forall<SEG_EXEC_POLICY>(iset, [=](int i) { pa[i] += 0.5 * pb[i]; });
+    benchmark::DoNotOptimize(pa[0]);
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+//
+// Three point stencil read through an index array, written once with a
+// scalar body and once with vector_exec and an explicit register type.
+//
+template <typename EXEC_POLICY>
+static void benchmark_forall_stencil(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  std::vector<double> a(n + 2, 1.0), b(n, 0.0);
+  std::vector<int> map(n);
+  for (int i = 0; i < n; ++i) {
+    map[i] = i;
+  }
+  const double* pa = a.data() + 1;
+  const int* pmap = map.data();
+  double* pb = b.data();
+
+  while (state.KeepRunning()) {
+    RAJA::forall<EXEC_POLICY>(RAJA::TypedRangeSegment<int>(0, n), [=](int i) {
+      pb[i] = 0.25 * pa[pmap[i] - 1] + 0.5 * pa[pmap[i]] +
+              0.25 * pa[pmap[i] + 1];
+    });
+    benchmark::DoNotOptimize(pb[0]);
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename VECTOR_TYPE>
+static void benchmark_forall_stencil_vector(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  std::vector<double> a(n + 2, 1.0), b(n, 0.0);
+  std::vector<int> map(n);
+  for (int i = 0; i < n; ++i) {
+    map[i] = i;
+  }
+  const double* pa = a.data() + 1;
+  const int* pmap = map.data();
+  double* pb = b.data();
+
+  while (state.KeepRunning()) {
+    RAJA::forall<RAJA::vector_exec<VECTOR_TYPE>>(
+        RAJA::TypedRangeSegment<int>(0, n),
+        [=](RAJA::VectorIndex<int, VECTOR_TYPE> i) {
+          VECTOR_TYPE left = i.gather(pa - 1, pmap);
+          VECTOR_TYPE center = i.gather(pa, pmap);
+          VECTOR_TYPE right = i.gather(pa + 1, pmap);
+          VECTOR_TYPE quarter(0.25);
+          i.store(pb,
+                  (left + right)
+                      .fused_multiply_add(quarter, center * VECTOR_TYPE(0.5)));
+        });
+    benchmark::DoNotOptimize(pb[0]);
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+using scalar_vector = RAJA::VectorRegister<double, RAJA::scalar_register>;
+using default_vector = RAJA::VectorRegister<double>;
+
+BENCHMARK_TEMPLATE(benchmark_forall_range, RAJA::seq_exec)
+    ->Apply(problem_sizes);
+BENCHMARK_TEMPLATE(benchmark_forall_range, RAJA::loop_exec)
+    ->Apply(problem_sizes);
+BENCHMARK_TEMPLATE(benchmark_forall_range, RAJA::simd_exec)
+    ->Apply(problem_sizes);
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_forall_range, RAJA::omp_parallel_for_exec)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_forall_range,
+                   RAJA::omp_parallel_for_static_exec<>)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_forall_range,
+                   RAJA::omp_parallel_for_dynamic_exec<256>)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+#endif
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(benchmark_forall_range, RAJA::tbb_for_exec)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_forall_range, RAJA::tbb_for_dynamic)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+#endif
+
+BENCHMARK_TEMPLATE(benchmark_forall_stencil, RAJA::loop_exec)
+    ->Apply(problem_sizes);
+BENCHMARK_TEMPLATE(benchmark_forall_stencil, RAJA::simd_exec)
+    ->Apply(problem_sizes);
+BENCHMARK_TEMPLATE(benchmark_forall_stencil_vector, scalar_vector)
+    ->Apply(problem_sizes);
+BENCHMARK_TEMPLATE(benchmark_forall_stencil_vector, default_vector)
+    ->Apply(problem_sizes);
+
+BENCHMARK_TEMPLATE(benchmark_forall_range_stride, RAJA::seq_exec)
+    ->Apply(problem_sizes);
+BENCHMARK_TEMPLATE(benchmark_forall_range_stride, RAJA::loop_exec)
+    ->Apply(problem_sizes);
+BENCHMARK_TEMPLATE(benchmark_forall_range_stride, RAJA::simd_exec)
+    ->Apply(problem_sizes);
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_forall_range_stride, RAJA::omp_parallel_for_exec)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+#endif
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(benchmark_forall_range_stride, RAJA::tbb_for_exec)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+#endif
+
+BENCHMARK_TEMPLATE(benchmark_forall_list, RAJA::seq_exec)
+    ->Apply(problem_sizes);
+BENCHMARK_TEMPLATE(benchmark_forall_list, RAJA::loop_exec)
+    ->Apply(problem_sizes);
+BENCHMARK_TEMPLATE(benchmark_forall_list, RAJA::simd_exec)
+    ->Apply(problem_sizes);
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_forall_list, RAJA::omp_parallel_for_exec)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+#endif
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(benchmark_forall_list, RAJA::tbb_for_exec)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+#endif
+
+using seq_segit_seq_exec = RAJA::ExecPolicy<RAJA::seq_segit, RAJA::seq_exec>;
+using seq_segit_loop_exec = RAJA::ExecPolicy<RAJA::seq_segit, RAJA::loop_exec>;
+using seq_segit_simd_exec = RAJA::ExecPolicy<RAJA::seq_segit, RAJA::simd_exec>;
+
+BENCHMARK_TEMPLATE(benchmark_forall_indexset, seq_segit_seq_exec)
+    ->Apply(problem_sizes);
+BENCHMARK_TEMPLATE(benchmark_forall_indexset, seq_segit_loop_exec)
+    ->Apply(problem_sizes);
+BENCHMARK_TEMPLATE(benchmark_forall_indexset, seq_segit_simd_exec)
+    ->Apply(problem_sizes);
+#if defined(RAJA_ENABLE_OPENMP)
+using omp_segit_seq_exec =
+    RAJA::ExecPolicy<RAJA::omp_parallel_for_segit, RAJA::seq_exec>;
+using seq_segit_omp_exec =
+    RAJA::ExecPolicy<RAJA::seq_segit, RAJA::omp_parallel_for_exec>;
+
+BENCHMARK_TEMPLATE(benchmark_forall_indexset, omp_segit_seq_exec)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_forall_indexset, seq_segit_omp_exec)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+#endif
+#if defined(RAJA_ENABLE_TBB)
+using tbb_segit_seq_exec = RAJA::ExecPolicy<RAJA::tbb_segit, RAJA::seq_exec>;
+
+BENCHMARK_TEMPLATE(benchmark_forall_indexset, tbb_segit_seq_exec)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+#endif
+
+BENCHMARK_MAIN();
@@ -0,0 +1,186 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Host kernel statements (For, Collapse, Tile and Hyperplane) with the
+// host execution policies that support them.
+//
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+static void problem_sizes(benchmark::internal::Benchmark* b)
+{
+  b->Arg(64);
+  b->Arg(1024);
+}
+
+//
+// 2D stencil with For statements, EXEC_POLICY applied to the outer loop
+//
+template <typename EXEC_POLICY>
+static void benchmark_kernel_for(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  std::vector<double> in(n * n, 1.0), out(n * n, 0.0);
+  RAJA::View<const double, RAJA::Layout<2>> vin(in.data(), n, n);
+  RAJA::View<double, RAJA::Layout<2>> vout(out.data(), n, n);
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::For<1, EXEC_POLICY,
+        RAJA::statement::For<0, RAJA::loop_exec,
+          RAJA::statement::Lambda<0>>>>;
+
+  while (state.KeepRunning()) {
+    RAJA::kernel<Pol>(RAJA::make_tuple(RAJA::RangeSegment(1, n - 1),
+                                       RAJA::RangeSegment(1, n - 1)),
+                      [=](int i, int j) {
+                        vout(j, i) = 0.25 * (vin(j, i - 1) + vin(j, i + 1) +
+                                             vin(j - 1, i) + vin(j + 1, i));
+                      });
+    benchmark::DoNotOptimize(out.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * (n - 2) * (n - 2));
+}
+
+//
+// the same stencil with both loops collapsed
+//
+template <typename COLLAPSE_POLICY>
+static void benchmark_kernel_collapse(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  std::vector<double> in(n * n, 1.0), out(n * n, 0.0);
+  RAJA::View<const double, RAJA::Layout<2>> vin(in.data(), n, n);
+  RAJA::View<double, RAJA::Layout<2>> vout(out.data(), n, n);
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::Collapse<COLLAPSE_POLICY,
+                                RAJA::ArgList<1, 0>,
+                                RAJA::statement::Lambda<0>>>;
+
+  while (state.KeepRunning()) {
+    RAJA::kernel<Pol>(RAJA::make_tuple(RAJA::RangeSegment(1, n - 1),
+                                       RAJA::RangeSegment(1, n - 1)),
+                      [=](int i, int j) {
+                        vout(j, i) = 0.25 * (vin(j, i - 1) + vin(j, i + 1) +
+                                             vin(j - 1, i) + vin(j + 1, i));
+                      });
+    benchmark::DoNotOptimize(out.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * (n - 2) * (n - 2));
+}
+
+//
+// matrix transpose tiled in both dimensions, EXEC_POLICY applied to the
+// outer tile loop
+//
+template <typename EXEC_POLICY>
+static void benchmark_kernel_tile(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  std::vector<double> in(n * n, 1.0), out(n * n, 0.0);
+  RAJA::View<const double, RAJA::Layout<2>> vin(in.data(), n, n);
+  RAJA::View<double, RAJA::Layout<2>> vout(out.data(), n, n);
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::Tile<1, RAJA::tile_fixed<32>, EXEC_POLICY,
+        RAJA::statement::Tile<0, RAJA::tile_fixed<32>, RAJA::loop_exec,
+          RAJA::statement::For<1, RAJA::loop_exec,
+            RAJA::statement::For<0, RAJA::loop_exec,
+              RAJA::statement::Lambda<0>>>>>>;
+
+  while (state.KeepRunning()) {
+    RAJA::kernel<Pol>(RAJA::make_tuple(RAJA::RangeSegment(0, n),
+                                       RAJA::RangeSegment(0, n)),
+                      [=](int i, int j) { vout(i, j) = vin(j, i); });
+    benchmark::DoNotOptimize(out.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+//
+// Gauss-Seidel style sweep where each point depends on its left and lower
+// neighbors, EXEC_POLICY applied within each hyperplane
+//
+template <typename EXEC_POLICY>
+static void benchmark_kernel_hyperplane(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  std::vector<double> x(n * n, 1.0);
+  RAJA::View<double, RAJA::Layout<2>> vx(x.data(), n, n);
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::Hyperplane<0, RAJA::seq_exec, RAJA::ArgList<1>,
+                                  EXEC_POLICY,
+                                  RAJA::statement::Lambda<0>>>;
+
+  while (state.KeepRunning()) {
+    RAJA::kernel<Pol>(RAJA::make_tuple(RAJA::RangeSegment(1, n),
+                                       RAJA::RangeSegment(1, n)),
+                      [=](int i, int j) {
+                        vx(i, j) = 0.5 * (vx(i - 1, j) + vx(i, j - 1));
+                      });
+    benchmark::DoNotOptimize(x.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * (n - 1) * (n - 1));
+}
+
+BENCHMARK_TEMPLATE(benchmark_kernel_for, RAJA::seq_exec)
+    ->Apply(problem_sizes);
+BENCHMARK_TEMPLATE(benchmark_kernel_for, RAJA::loop_exec)
+    ->Apply(problem_sizes);
+BENCHMARK_TEMPLATE(benchmark_kernel_for, RAJA::simd_exec)
+    ->Apply(problem_sizes);
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_kernel_for, RAJA::omp_parallel_for_exec)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+#endif
+
+BENCHMARK_TEMPLATE(benchmark_kernel_collapse, RAJA::seq_exec)
+    ->Apply(problem_sizes);
+BENCHMARK_TEMPLATE(benchmark_kernel_collapse, RAJA::loop_exec)
+    ->Apply(problem_sizes);
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_kernel_collapse, RAJA::omp_parallel_collapse_exec)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_kernel_collapse,
+                   RAJA::omp_parallel_collapse_static_exec<>)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+#endif
+
+BENCHMARK_TEMPLATE(benchmark_kernel_tile, RAJA::seq_exec)
+    ->Apply(problem_sizes);
+BENCHMARK_TEMPLATE(benchmark_kernel_tile, RAJA::loop_exec)
+    ->Apply(problem_sizes);
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_kernel_tile, RAJA::omp_parallel_for_exec)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+#endif
+
+BENCHMARK_TEMPLATE(benchmark_kernel_hyperplane, RAJA::seq_exec)
+    ->Apply(problem_sizes);
+BENCHMARK_TEMPLATE(benchmark_kernel_hyperplane, RAJA::loop_exec)
+    ->Apply(problem_sizes);
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_kernel_hyperplane, RAJA::omp_parallel_for_exec)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+#endif
+
+BENCHMARK_MAIN();
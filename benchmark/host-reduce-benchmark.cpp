@@ -0,0 +1,180 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Host reducers for each pair of execution and reduction policy. The sum
+// kernel measures a single reducer, the other kernel uses every reducer
+// type at once.
+//
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+static void problem_sizes(benchmark::internal::Benchmark* b)
+{
+  b->Arg(1 << 12);
+  b->Arg(1 << 20);
+}
+
+template <typename EXEC_POLICY, typename REDUCE_POLICY>
+static void benchmark_reduce_sum(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  std::vector<double> a(n);
+  for (int i = 0; i < n; ++i) {
+    a[i] = static_cast<double>(i % 1000) - 500.0;
+  }
+  const double* pa = a.data();
+
+  RAJA::ReduceSum<REDUCE_POLICY, double> sum(0.0);
+
+  while (state.KeepRunning()) {
+    sum.reset(0.0);
+    RAJA::forall<EXEC_POLICY>(RAJA::TypedRangeSegment<int>(0, n),
+                              [=](int i) { sum += pa[i]; });
+    benchmark::DoNotOptimize(sum.get());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename EXEC_POLICY, typename REDUCE_POLICY>
+static void benchmark_reduce_all(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  std::vector<double> a(n);
+  for (int i = 0; i < n; ++i) {
+    a[i] = static_cast<double>(i % 1000) - 500.0;
+  }
+  const double* pa = a.data();
+
+  RAJA::ReduceSum<REDUCE_POLICY, double> sum(0.0);
+  RAJA::ReduceMin<REDUCE_POLICY, double> min(0.0);
+  RAJA::ReduceMax<REDUCE_POLICY, double> max(0.0);
+  RAJA::ReduceMinLoc<REDUCE_POLICY, double> minloc(0.0, -1);
+  RAJA::ReduceMaxLoc<REDUCE_POLICY, double> maxloc(0.0, -1);
+  RAJA::ReduceBitOr<REDUCE_POLICY, int> bit_or(0);
+  RAJA::ReduceBitAnd<REDUCE_POLICY, int> bit_and(~0);
+
+  while (state.KeepRunning()) {
+    sum.reset(0.0);
+    min.reset(0.0);
+    max.reset(0.0);
+    minloc.reset(0.0, -1);
+    maxloc.reset(0.0, -1);
+    bit_or.reset(0);
+    bit_and.reset(~0);
+
+    RAJA::forall<EXEC_POLICY>(RAJA::TypedRangeSegment<int>(0, n),
+                              [=](int i) {
+                                sum += pa[i];
+                                min.min(pa[i]);
+                                max.max(pa[i]);
+                                minloc.minloc(pa[i], i);
+                                maxloc.maxloc(pa[i], i);
+                                bit_or |= i;
+                                bit_and &= ~i;
+                              });
+
+    benchmark::DoNotOptimize(sum.get());
+    benchmark::DoNotOptimize(min.get());
+    benchmark::DoNotOptimize(max.get());
+    benchmark::DoNotOptimize(minloc.getLoc());
+    benchmark::DoNotOptimize(maxloc.getLoc());
+    benchmark::DoNotOptimize(bit_or.get());
+    benchmark::DoNotOptimize(bit_and.get());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+BENCHMARK_TEMPLATE2(benchmark_reduce_sum, RAJA::seq_exec, RAJA::seq_reduce)
+    ->Apply(problem_sizes);
+BENCHMARK_TEMPLATE2(benchmark_reduce_sum, RAJA::loop_exec, RAJA::seq_reduce)
+    ->Apply(problem_sizes);
+BENCHMARK_TEMPLATE2(benchmark_reduce_sum, RAJA::simd_exec, RAJA::seq_reduce)
+    ->Apply(problem_sizes);
+BENCHMARK_TEMPLATE2(benchmark_reduce_sum,
+                    RAJA::loop_exec,
+                    RAJA::seq_reduce_reproducible)
+    ->Apply(problem_sizes);
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE2(benchmark_reduce_sum,
+                    RAJA::omp_parallel_for_exec,
+                    RAJA::omp_reduce)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE2(benchmark_reduce_sum,
+                    RAJA::omp_parallel_for_exec,
+                    RAJA::omp_reduce_ordered)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE2(benchmark_reduce_sum,
+                    RAJA::omp_parallel_for_exec,
+                    RAJA::omp_reduce_padded)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE2(benchmark_reduce_sum,
+                    RAJA::omp_parallel_for_exec,
+                    RAJA::omp_reduce_reproducible)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+#endif
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE2(benchmark_reduce_sum, RAJA::tbb_for_exec, RAJA::tbb_reduce)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE2(benchmark_reduce_sum,
+                    RAJA::tbb_for_exec,
+                    RAJA::tbb_reduce_chunked)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE2(benchmark_reduce_sum,
+                    RAJA::tbb_for_exec,
+                    RAJA::tbb_reduce_reproducible)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+#endif
+
+BENCHMARK_TEMPLATE2(benchmark_reduce_all, RAJA::seq_exec, RAJA::seq_reduce)
+    ->Apply(problem_sizes);
+BENCHMARK_TEMPLATE2(benchmark_reduce_all, RAJA::loop_exec, RAJA::seq_reduce)
+    ->Apply(problem_sizes);
+BENCHMARK_TEMPLATE2(benchmark_reduce_all, RAJA::simd_exec, RAJA::seq_reduce)
+    ->Apply(problem_sizes);
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE2(benchmark_reduce_all,
+                    RAJA::omp_parallel_for_exec,
+                    RAJA::omp_reduce)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE2(benchmark_reduce_all,
+                    RAJA::omp_parallel_for_exec,
+                    RAJA::omp_reduce_ordered)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE2(benchmark_reduce_all,
+                    RAJA::omp_parallel_for_exec,
+                    RAJA::omp_reduce_padded)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+#endif
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE2(benchmark_reduce_all, RAJA::tbb_for_exec, RAJA::tbb_reduce)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE2(benchmark_reduce_all,
+                    RAJA::tbb_for_exec,
+                    RAJA::tbb_reduce_chunked)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+#endif
+
+BENCHMARK_MAIN();
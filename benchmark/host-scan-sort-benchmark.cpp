@@ -0,0 +1,173 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Host scans and sorts for each host execution policy that supports them.
+// Sorts restore the unsorted input outside of the timed region.
+//
+
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+static void problem_sizes(benchmark::internal::Benchmark* b)
+{
+  b->Arg(1 << 12);
+  b->Arg(1 << 20);
+}
+
+static std::vector<int> unsorted_keys(int n)
+{
+  std::mt19937 gen(12345);
+  std::uniform_int_distribution<int> dist(0, n);
+  std::vector<int> keys(n);
+  for (int i = 0; i < n; ++i) {
+    keys[i] = dist(gen);
+  }
+  return keys;
+}
+
+template <typename EXEC_POLICY>
+static void benchmark_inclusive_scan(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  std::vector<int> in(n, 1), out(n, 0);
+
+  while (state.KeepRunning()) {
+    RAJA::inclusive_scan<EXEC_POLICY>(RAJA::make_span(in.data(), n),
+                                      RAJA::make_span(out.data(), n),
+                                      RAJA::operators::plus<int>{});
+    benchmark::DoNotOptimize(out.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename EXEC_POLICY>
+static void benchmark_exclusive_scan_inplace(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  std::vector<int> data(n, 0);
+
+  while (state.KeepRunning()) {
+    RAJA::exclusive_scan_inplace<EXEC_POLICY>(RAJA::make_span(data.data(), n),
+                                              RAJA::operators::plus<int>{});
+    benchmark::DoNotOptimize(data.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename EXEC_POLICY>
+static void benchmark_sort(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  const std::vector<int> input = unsorted_keys(n);
+  std::vector<int> keys(n);
+
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    keys = input;
+    state.ResumeTiming();
+
+    RAJA::sort<EXEC_POLICY>(RAJA::make_span(keys.data(), n));
+    benchmark::DoNotOptimize(keys.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+template <typename EXEC_POLICY>
+static void benchmark_sort_pairs(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  const std::vector<int> input = unsorted_keys(n);
+  std::vector<int> keys(n);
+  std::vector<double> vals(n);
+
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    keys = input;
+    for (int i = 0; i < n; ++i) {
+      vals[i] = static_cast<double>(i);
+    }
+    state.ResumeTiming();
+
+    RAJA::sort_pairs<EXEC_POLICY>(RAJA::make_span(keys.data(), n),
+                                  RAJA::make_span(vals.data(), n));
+    benchmark::DoNotOptimize(keys.data());
+    benchmark::DoNotOptimize(vals.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n);
+}
+
+BENCHMARK_TEMPLATE(benchmark_inclusive_scan, RAJA::seq_exec)
+    ->Apply(problem_sizes);
+BENCHMARK_TEMPLATE(benchmark_inclusive_scan, RAJA::loop_exec)
+    ->Apply(problem_sizes);
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_inclusive_scan, RAJA::omp_parallel_for_exec)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+#endif
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(benchmark_inclusive_scan, RAJA::tbb_for_exec)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+#endif
+
+BENCHMARK_TEMPLATE(benchmark_exclusive_scan_inplace, RAJA::seq_exec)
+    ->Apply(problem_sizes);
+BENCHMARK_TEMPLATE(benchmark_exclusive_scan_inplace, RAJA::loop_exec)
+    ->Apply(problem_sizes);
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_exclusive_scan_inplace,
+                   RAJA::omp_parallel_for_exec)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+#endif
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(benchmark_exclusive_scan_inplace, RAJA::tbb_for_exec)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+#endif
+
+BENCHMARK_TEMPLATE(benchmark_sort, RAJA::seq_exec)
+    ->Apply(problem_sizes);
+BENCHMARK_TEMPLATE(benchmark_sort, RAJA::loop_exec)
+    ->Apply(problem_sizes);
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_sort, RAJA::omp_parallel_for_exec)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+#endif
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(benchmark_sort, RAJA::tbb_for_exec)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+#endif
+
+BENCHMARK_TEMPLATE(benchmark_sort_pairs, RAJA::seq_exec)
+    ->Apply(problem_sizes);
+BENCHMARK_TEMPLATE(benchmark_sort_pairs, RAJA::loop_exec)
+    ->Apply(problem_sizes);
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_sort_pairs, RAJA::omp_parallel_for_exec)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+#endif
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(benchmark_sort_pairs, RAJA::tbb_for_exec)
+    ->Apply(problem_sizes)
+    ->UseRealTime();
+#endif
+
+BENCHMARK_MAIN();
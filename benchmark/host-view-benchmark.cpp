@@ -0,0 +1,240 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Cost of View and Layout indexing on the host compared to the same kernel
+// written against raw pointers, for each host execution policy. The
+// benchmark argument is the extent of each dimension.
+//
+
+#include <array>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+RAJA_INDEX_VALUE_T(IIDX, int, "IIDX");
+RAJA_INDEX_VALUE_T(JIDX, int, "JIDX");
+
+static void extents_2d(benchmark::internal::Benchmark* b)
+{
+  b->Arg(64);
+  b->Arg(1024);
+}
+
+static void extents_3d(benchmark::internal::Benchmark* b)
+{
+  b->Arg(16);
+  b->Arg(128);
+}
+
+template <typename EXEC_POLICY>
+static void benchmark_view2d_raw(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  std::vector<double> a(n * n, 1.0), b(n * n, 2.0);
+  double* pa = a.data();
+  const double* pb = b.data();
+
+  while (state.KeepRunning()) {
+    RAJA::forall<EXEC_POLICY>(RAJA::TypedRangeSegment<int>(0, n * n),
+                              [=](int ij) {
+                                const int i = ij / n;
+                                const int j = ij % n;
+                                pa[i * n + j] += pb[j * n + i];
+                              });
+    benchmark::DoNotOptimize(pa[0]);
+  }
+
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+template <typename EXEC_POLICY>
+static void benchmark_view2d_layout(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  std::vector<double> a(n * n, 1.0), b(n * n, 2.0);
+  RAJA::View<double, RAJA::Layout<2, int>> va(a.data(), n, n);
+  RAJA::View<const double, RAJA::Layout<2, int>> vb(b.data(), n, n);
+
+  while (state.KeepRunning()) {
+    RAJA::forall<EXEC_POLICY>(RAJA::TypedRangeSegment<int>(0, n * n),
+                              [=](int ij) {
+                                const int i = ij / n;
+                                const int j = ij % n;
+                                va(i, j) += vb(j, i);
+                              });
+    benchmark::DoNotOptimize(a[0]);
+  }
+
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+template <typename EXEC_POLICY>
+static void benchmark_view2d_permuted(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  std::vector<double> a(n * n, 1.0), b(n * n, 2.0);
+  std::array<RAJA::idx_t, 2> perm{{1, 0}};
+  RAJA::View<double, RAJA::Layout<2>> va(a.data(),
+                                         RAJA::make_permuted_layout({{n, n}},
+                                                                    perm));
+  RAJA::View<const double, RAJA::Layout<2>> vb(b.data(), n, n);
+
+  while (state.KeepRunning()) {
+    RAJA::forall<EXEC_POLICY>(RAJA::TypedRangeSegment<int>(0, n * n),
+                              [=](int ij) {
+                                const int i = ij / n;
+                                const int j = ij % n;
+                                va(j, i) += vb(j, i);
+                              });
+    benchmark::DoNotOptimize(a[0]);
+  }
+
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+template <typename EXEC_POLICY>
+static void benchmark_view2d_offset(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  std::vector<double> a(n * n, 1.0), b(n * n, 2.0);
+  RAJA::View<double, RAJA::OffsetLayout<2>> va(
+      a.data(), RAJA::make_offset_layout<2>({{-1, -1}}, {{n - 2, n - 2}}));
+  RAJA::View<const double, RAJA::Layout<2>> vb(b.data(), n, n);
+
+  while (state.KeepRunning()) {
+    RAJA::forall<EXEC_POLICY>(RAJA::TypedRangeSegment<int>(0, n * n),
+                              [=](int ij) {
+                                const int i = ij / n;
+                                const int j = ij % n;
+                                va(i - 1, j - 1) += vb(j, i);
+                              });
+    benchmark::DoNotOptimize(a[0]);
+  }
+
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+template <typename EXEC_POLICY>
+static void benchmark_view2d_typed(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  std::vector<double> a(n * n, 1.0), b(n * n, 2.0);
+  RAJA::TypedView<double, RAJA::Layout<2>, IIDX, JIDX> va(a.data(), n, n);
+  RAJA::TypedView<const double, RAJA::Layout<2>, JIDX, IIDX> vb(b.data(),
+                                                                 n,
+                                                                 n);
+
+  while (state.KeepRunning()) {
+    RAJA::forall<EXEC_POLICY>(RAJA::TypedRangeSegment<int>(0, n * n),
+                              [=](int ij) {
+                                const IIDX i(ij / n);
+                                const JIDX j(ij % n);
+                                va(i, j) += vb(j, i);
+                              });
+    benchmark::DoNotOptimize(a[0]);
+  }
+
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+template <typename EXEC_POLICY>
+static void benchmark_view3d_raw(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  std::vector<double> a(n * n * n, 1.0), b(n * n * n, 2.0);
+  double* pa = a.data();
+  const double* pb = b.data();
+
+  using KERNEL_POLICY = RAJA::KernelPolicy<RAJA::statement::For<
+      0,
+      EXEC_POLICY,
+      RAJA::statement::For<
+          1,
+          RAJA::loop_exec,
+          RAJA::statement::For<2, RAJA::loop_exec, RAJA::statement::Lambda<0>>>>>;
+
+  while (state.KeepRunning()) {
+    RAJA::kernel<KERNEL_POLICY>(
+        RAJA::make_tuple(RAJA::TypedRangeSegment<int>(0, n),
+                         RAJA::TypedRangeSegment<int>(0, n),
+                         RAJA::TypedRangeSegment<int>(0, n)),
+        [=](int i, int j, int k) {
+          pa[(i * n + j) * n + k] += pb[(k * n + j) * n + i];
+        });
+    benchmark::DoNotOptimize(pa[0]);
+  }
+
+  state.SetItemsProcessed(state.iterations() * n * n * n);
+}
+
+template <typename EXEC_POLICY>
+static void benchmark_view3d_layout(benchmark::State& state)
+{
+  const int n = static_cast<int>(state.range(0));
+  std::vector<double> a(n * n * n, 1.0), b(n * n * n, 2.0);
+  RAJA::View<double, RAJA::Layout<3, int>> va(a.data(), n, n, n);
+  RAJA::View<const double, RAJA::Layout<3, int>> vb(b.data(), n, n, n);
+
+  using KERNEL_POLICY = RAJA::KernelPolicy<RAJA::statement::For<
+      0,
+      EXEC_POLICY,
+      RAJA::statement::For<
+          1,
+          RAJA::loop_exec,
+          RAJA::statement::For<2, RAJA::loop_exec, RAJA::statement::Lambda<0>>>>>;
+
+  while (state.KeepRunning()) {
+    RAJA::kernel<KERNEL_POLICY>(
+        RAJA::make_tuple(RAJA::TypedRangeSegment<int>(0, n),
+                         RAJA::TypedRangeSegment<int>(0, n),
+                         RAJA::TypedRangeSegment<int>(0, n)),
+        [=](int i, int j, int k) { va(i, j, k) += vb(k, j, i); });
+    benchmark::DoNotOptimize(a[0]);
+  }
+
+  state.SetItemsProcessed(state.iterations() * n * n * n);
+}
+
+BENCHMARK_TEMPLATE(benchmark_view2d_raw, RAJA::seq_exec)->Apply(extents_2d);
+BENCHMARK_TEMPLATE(benchmark_view2d_raw, RAJA::loop_exec)->Apply(extents_2d);
+BENCHMARK_TEMPLATE(benchmark_view2d_raw, RAJA::simd_exec)->Apply(extents_2d);
+BENCHMARK_TEMPLATE(benchmark_view2d_layout, RAJA::seq_exec)->Apply(extents_2d);
+BENCHMARK_TEMPLATE(benchmark_view2d_layout, RAJA::loop_exec)->Apply(extents_2d);
+BENCHMARK_TEMPLATE(benchmark_view2d_layout, RAJA::simd_exec)->Apply(extents_2d);
+BENCHMARK_TEMPLATE(benchmark_view2d_permuted, RAJA::loop_exec)
+    ->Apply(extents_2d);
+BENCHMARK_TEMPLATE(benchmark_view2d_offset, RAJA::loop_exec)->Apply(extents_2d);
+BENCHMARK_TEMPLATE(benchmark_view2d_typed, RAJA::loop_exec)->Apply(extents_2d);
+BENCHMARK_TEMPLATE(benchmark_view3d_raw, RAJA::loop_exec)->Apply(extents_3d);
+BENCHMARK_TEMPLATE(benchmark_view3d_layout, RAJA::loop_exec)->Apply(extents_3d);
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_view2d_raw, RAJA::omp_parallel_for_exec)
+    ->Apply(extents_2d)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_view2d_layout, RAJA::omp_parallel_for_exec)
+    ->Apply(extents_2d)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_view3d_raw, RAJA::omp_parallel_for_exec)
+    ->Apply(extents_3d)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_view3d_layout, RAJA::omp_parallel_for_exec)
+    ->Apply(extents_3d)
+    ->UseRealTime();
+#endif
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(benchmark_view2d_raw, RAJA::tbb_for_exec)
+    ->Apply(extents_2d)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_view2d_layout, RAJA::tbb_for_exec)
+    ->Apply(extents_2d)
+    ->UseRealTime();
+#endif
+
+BENCHMARK_MAIN();
@@ -0,0 +1,149 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Host WorkGroup costs, split into enqueuing many small loops into a pool,
+// instantiating the pool into a group, and running a group that is reused.
+// The benchmark argument is the number of loops.
+//
+
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+#define LOOP_LENGTH 256
+
+static void num_loops(benchmark::internal::Benchmark* b)
+{
+  b->Arg(16);
+  b->Arg(1024);
+}
+
+template <typename WORKGROUP_POLICY>
+using workpool_type = RAJA::WorkPool<WORKGROUP_POLICY,
+                                     int,
+                                     RAJA::xargs<>,
+                                     std::allocator<char>>;
+
+template <typename WORKGROUP_POLICY>
+using workgroup_type = RAJA::WorkGroup<WORKGROUP_POLICY,
+                                       int,
+                                       RAJA::xargs<>,
+                                       std::allocator<char>>;
+
+template <typename WORKGROUP_POLICY>
+static void fill_pool(workpool_type<WORKGROUP_POLICY>& pool,
+                      std::vector<double>& data,
+                      int loops)
+{
+  pool.reserve(loops, loops * 64);
+  for (int l = 0; l < loops; ++l) {
+    double* pdata = data.data() + l * LOOP_LENGTH;
+    pool.enqueue(RAJA::TypedRangeSegment<int>(0, LOOP_LENGTH),
+                 [=](int i) { pdata[i] += 1.0; });
+  }
+}
+
+template <typename WORKGROUP_POLICY>
+static void benchmark_workgroup_enqueue_instantiate(benchmark::State& state)
+{
+  const int loops = static_cast<int>(state.range(0));
+  std::vector<double> data(loops * LOOP_LENGTH, 0.0);
+  workpool_type<WORKGROUP_POLICY> pool(std::allocator<char>{});
+
+  while (state.KeepRunning()) {
+    fill_pool<WORKGROUP_POLICY>(pool, data, loops);
+    workgroup_type<WORKGROUP_POLICY> group = pool.instantiate();
+    benchmark::DoNotOptimize(&group);
+  }
+
+  state.SetItemsProcessed(state.iterations() * loops);
+}
+
+template <typename WORKGROUP_POLICY>
+static void benchmark_workgroup_run(benchmark::State& state)
+{
+  const int loops = static_cast<int>(state.range(0));
+  std::vector<double> data(loops * LOOP_LENGTH, 0.0);
+  workpool_type<WORKGROUP_POLICY> pool(std::allocator<char>{});
+
+  fill_pool<WORKGROUP_POLICY>(pool, data, loops);
+  workgroup_type<WORKGROUP_POLICY> group = pool.instantiate();
+
+  while (state.KeepRunning()) {
+    auto site = group.run();
+    benchmark::DoNotOptimize(data[0]);
+  }
+
+  state.SetItemsProcessed(state.iterations() * loops * LOOP_LENGTH);
+}
+
+using seq_work_ordered = RAJA::WorkGroupPolicy<RAJA::seq_work,
+                                               RAJA::ordered,
+                                               RAJA::ragged_array_of_objects>;
+using loop_work_ordered = RAJA::WorkGroupPolicy<RAJA::loop_work,
+                                                RAJA::ordered,
+                                                RAJA::ragged_array_of_objects>;
+using loop_work_pointers = RAJA::WorkGroupPolicy<RAJA::loop_work,
+                                                 RAJA::ordered,
+                                                 RAJA::array_of_pointers>;
+#if defined(RAJA_ENABLE_OPENMP)
+using omp_work_ordered = RAJA::WorkGroupPolicy<RAJA::omp_work,
+                                               RAJA::ordered,
+                                               RAJA::ragged_array_of_objects>;
+using omp_work_flattened =
+    RAJA::WorkGroupPolicy<RAJA::omp_work,
+                          RAJA::unordered_omp_flattened_static,
+                          RAJA::ragged_array_of_objects>;
+#endif
+#if defined(RAJA_ENABLE_TBB)
+using tbb_work_ordered = RAJA::WorkGroupPolicy<RAJA::tbb_work,
+                                               RAJA::ordered,
+                                               RAJA::ragged_array_of_objects>;
+#endif
+
+BENCHMARK_TEMPLATE(benchmark_workgroup_enqueue_instantiate, seq_work_ordered)
+    ->Apply(num_loops);
+BENCHMARK_TEMPLATE(benchmark_workgroup_enqueue_instantiate, loop_work_ordered)
+    ->Apply(num_loops);
+BENCHMARK_TEMPLATE(benchmark_workgroup_enqueue_instantiate, loop_work_pointers)
+    ->Apply(num_loops);
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_workgroup_enqueue_instantiate, omp_work_ordered)
+    ->Apply(num_loops);
+BENCHMARK_TEMPLATE(benchmark_workgroup_enqueue_instantiate, omp_work_flattened)
+    ->Apply(num_loops);
+#endif
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(benchmark_workgroup_enqueue_instantiate, tbb_work_ordered)
+    ->Apply(num_loops);
+#endif
+
+BENCHMARK_TEMPLATE(benchmark_workgroup_run, seq_work_ordered)
+    ->Apply(num_loops);
+BENCHMARK_TEMPLATE(benchmark_workgroup_run, loop_work_ordered)
+    ->Apply(num_loops);
+BENCHMARK_TEMPLATE(benchmark_workgroup_run, loop_work_pointers)
+    ->Apply(num_loops);
+#if defined(RAJA_ENABLE_OPENMP)
+BENCHMARK_TEMPLATE(benchmark_workgroup_run, omp_work_ordered)
+    ->Apply(num_loops)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_workgroup_run, omp_work_flattened)
+    ->Apply(num_loops)
+    ->UseRealTime();
+#endif
+#if defined(RAJA_ENABLE_TBB)
+BENCHMARK_TEMPLATE(benchmark_workgroup_run, tbb_work_ordered)
+    ->Apply(num_loops)
+    ->UseRealTime();
+#endif
+
+BENCHMARK_MAIN();
@@ -0,0 +1,131 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Cost of Layout::toIndices, which divides by each stride and size, compared
+// to FastDivLayout::toIndices, which multiplies by precomputed reciprocals.
+// The benchmark argument is the extent of each dimension; it is only known
+// at run time so the compiler cannot strength-reduce the divides itself.
+//
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+static void extents_2d(benchmark::internal::Benchmark* b)
+{
+  b->Arg(61);
+  b->Arg(1021);
+}
+
+static void extents_3d(benchmark::internal::Benchmark* b)
+{
+  b->Arg(13);
+  b->Arg(101);
+}
+
+static void extents_4d(benchmark::internal::Benchmark* b)
+{
+  b->Arg(7);
+  b->Arg(31);
+}
+
+template <typename LAYOUT, typename EXEC_POLICY>
+static void benchmark_toindices_2d(benchmark::State& state)
+{
+  using IdxLin = typename LAYOUT::IndexLinear;
+  const IdxLin n = static_cast<IdxLin>(state.range(0));
+  const LAYOUT layout(n, n);
+
+  while (state.KeepRunning()) {
+    RAJA::ReduceSum<RAJA::seq_reduce, IdxLin> sum(0);
+    RAJA::forall<EXEC_POLICY>(RAJA::TypedRangeSegment<IdxLin>(0, n * n),
+                              [=](IdxLin lin) {
+                                IdxLin i, j;
+                                layout.toIndices(lin, i, j);
+                                sum += i + j;
+                              });
+    benchmark::DoNotOptimize(sum.get());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+template <typename LAYOUT, typename EXEC_POLICY>
+static void benchmark_toindices_3d(benchmark::State& state)
+{
+  using IdxLin = typename LAYOUT::IndexLinear;
+  const IdxLin n = static_cast<IdxLin>(state.range(0));
+  const LAYOUT layout(n, n, n);
+
+  while (state.KeepRunning()) {
+    RAJA::ReduceSum<RAJA::seq_reduce, IdxLin> sum(0);
+    RAJA::forall<EXEC_POLICY>(RAJA::TypedRangeSegment<IdxLin>(0, n * n * n),
+                              [=](IdxLin lin) {
+                                IdxLin i, j, k;
+                                layout.toIndices(lin, i, j, k);
+                                sum += i + j + k;
+                              });
+    benchmark::DoNotOptimize(sum.get());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n * n * n);
+}
+
+template <typename LAYOUT, typename EXEC_POLICY>
+static void benchmark_toindices_4d(benchmark::State& state)
+{
+  using IdxLin = typename LAYOUT::IndexLinear;
+  const IdxLin n = static_cast<IdxLin>(state.range(0));
+  const LAYOUT layout(n, n, n, n);
+
+  while (state.KeepRunning()) {
+    RAJA::ReduceSum<RAJA::seq_reduce, IdxLin> sum(0);
+    RAJA::forall<EXEC_POLICY>(RAJA::TypedRangeSegment<IdxLin>(0, n * n * n * n),
+                              [=](IdxLin lin) {
+                                IdxLin i, j, k, l;
+                                layout.toIndices(lin, i, j, k, l);
+                                sum += i + j + k + l;
+                              });
+    benchmark::DoNotOptimize(sum.get());
+  }
+
+  state.SetItemsProcessed(state.iterations() * n * n * n * n);
+}
+
+BENCHMARK_TEMPLATE(benchmark_toindices_2d, RAJA::Layout<2, int>, RAJA::loop_exec)
+    ->Apply(extents_2d);
+BENCHMARK_TEMPLATE(benchmark_toindices_2d,
+                   RAJA::FastDivLayout<2, int>,
+                   RAJA::loop_exec)
+    ->Apply(extents_2d);
+BENCHMARK_TEMPLATE(benchmark_toindices_2d, RAJA::Layout<2>, RAJA::loop_exec)
+    ->Apply(extents_2d);
+BENCHMARK_TEMPLATE(benchmark_toindices_2d, RAJA::FastDivLayout<2>, RAJA::loop_exec)
+    ->Apply(extents_2d);
+BENCHMARK_TEMPLATE(benchmark_toindices_3d, RAJA::Layout<3, int>, RAJA::loop_exec)
+    ->Apply(extents_3d);
+BENCHMARK_TEMPLATE(benchmark_toindices_3d,
+                   RAJA::FastDivLayout<3, int>,
+                   RAJA::loop_exec)
+    ->Apply(extents_3d);
+BENCHMARK_TEMPLATE(benchmark_toindices_3d, RAJA::Layout<3>, RAJA::loop_exec)
+    ->Apply(extents_3d);
+BENCHMARK_TEMPLATE(benchmark_toindices_3d, RAJA::FastDivLayout<3>, RAJA::loop_exec)
+    ->Apply(extents_3d);
+BENCHMARK_TEMPLATE(benchmark_toindices_4d, RAJA::Layout<4, int>, RAJA::loop_exec)
+    ->Apply(extents_4d);
+BENCHMARK_TEMPLATE(benchmark_toindices_4d,
+                   RAJA::FastDivLayout<4, int>,
+                   RAJA::loop_exec)
+    ->Apply(extents_4d);
+BENCHMARK_TEMPLATE(benchmark_toindices_4d, RAJA::Layout<4>, RAJA::loop_exec)
+    ->Apply(extents_4d);
+BENCHMARK_TEMPLATE(benchmark_toindices_4d, RAJA::FastDivLayout<4>, RAJA::loop_exec)
+    ->Apply(extents_4d);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,58 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Measures get/give throughput of basic_mempool::detail::MemoryArena, the
+// book-keeping behind MemPool, as the number of live chunks grows. Chunks
+// of mixed sizes are freed in random order so the arena stays fragmented.
+//
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+#define OPS 100000
+#define ARENA_SIZE (64ull * 1024ull * 1024ull)
+
+static void benchmark_memory_arena(benchmark::State& state)
+{
+  const size_t num_slots = static_cast<size_t>(state.range(0));
+
+  std::vector<char> memory(ARENA_SIZE);
+  RAJA::basic_mempool::detail::MemoryArena arena(memory.data(),
+                                                 memory.size());
+  std::vector<void*> slots(num_slots, nullptr);
+  size_t seed = 1;
+
+  while (state.KeepRunning()) {
+    for (int i = 0; i < OPS; ++i) {
+      seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+      void*& slot = slots[(seed >> 33) % num_slots];
+      if (slot != nullptr) {
+        arena.give(slot);
+        slot = nullptr;
+      } else {
+        slot = arena.get(16 + (seed >> 20) % 4096, 16);
+      }
+      benchmark::DoNotOptimize(slot);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * OPS);
+
+  for (void* ptr : slots) {
+    if (ptr != nullptr) {
+      arena.give(ptr);
+    }
+  }
+}
+
+BENCHMARK(benchmark_memory_arena)->RangeMultiplier(8)->Range(8, 8 << 9);
+
+BENCHMARK_MAIN();
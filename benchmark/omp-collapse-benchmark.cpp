@@ -0,0 +1,147 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Compares the 2 and 3 loop omp_parallel_collapse_exec specializations,
+// which assign every offset in the innermost loop, with the collapse
+// executor for any number of loops and a given OpenMP schedule, which
+// only assigns the innermost offset there. The 4 loop kernels follow a
+// transport sweep (group, direction, zone, moment) and compare schedules.
+//
+
+#include <omp.h>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+#define NUM_GROUPS 16
+#define NUM_DIRECTIONS 32
+#define NUM_ZONES 4096
+#define NUM_MOMENTS 4
+
+template <typename COLLAPSE_POLICY>
+static void benchmark_omp_collapse_2(benchmark::State& state)
+{
+  const int ni = NUM_GROUPS * NUM_DIRECTIONS;
+  const int nj = NUM_ZONES * NUM_MOMENTS;
+  double* a = new double[ni * nj];
+  for (int i = 0; i < ni * nj; i++) {
+    a[i] = 1.0;
+  }
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::Collapse<COLLAPSE_POLICY,
+                                RAJA::ArgList<0, 1>,
+                                RAJA::statement::Lambda<0>>>;
+
+  while (state.KeepRunning()) {
+    RAJA::kernel<Pol>(RAJA::make_tuple(RAJA::RangeSegment(0, ni),
+                                       RAJA::RangeSegment(0, nj)),
+                      [=](int i, int j) { a[j + nj * i] *= 1.0001; });
+    benchmark::DoNotOptimize(a[0]);
+  }
+
+  state.SetItemsProcessed(state.iterations() * ni * nj);
+
+  delete[] a;
+}
+
+template <typename COLLAPSE_POLICY>
+static void benchmark_omp_collapse_3(benchmark::State& state)
+{
+  const int nk = NUM_GROUPS;
+  const int nj = NUM_DIRECTIONS;
+  const int ni = NUM_ZONES * NUM_MOMENTS;
+  double* a = new double[nk * nj * ni];
+  for (int i = 0; i < nk * nj * ni; i++) {
+    a[i] = 1.0;
+  }
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::Collapse<COLLAPSE_POLICY,
+                                RAJA::ArgList<0, 1, 2>,
+                                RAJA::statement::Lambda<0>>>;
+
+  while (state.KeepRunning()) {
+    RAJA::kernel<Pol>(RAJA::make_tuple(RAJA::RangeSegment(0, nk),
+                                       RAJA::RangeSegment(0, nj),
+                                       RAJA::RangeSegment(0, ni)),
+                      [=](int k, int j, int i) {
+                        a[i + ni * (j + nj * k)] *= 1.0001;
+                      });
+    benchmark::DoNotOptimize(a[0]);
+  }
+
+  state.SetItemsProcessed(state.iterations() * nk * nj * ni);
+
+  delete[] a;
+}
+
+template <typename COLLAPSE_POLICY>
+static void benchmark_omp_collapse_4(benchmark::State& state)
+{
+  const int ng = NUM_GROUPS;
+  const int nd = NUM_DIRECTIONS;
+  const int nz = NUM_ZONES;
+  const int nm = NUM_MOMENTS;
+  double* phi = new double[ng * nz * nm];
+  double* ell = new double[nd * nm];
+  double* psi_m = new double[ng * nd * nz * nm];
+  for (int i = 0; i < ng * nz * nm; i++) {
+    phi[i] = 1.0;
+  }
+  for (int i = 0; i < nd * nm; i++) {
+    ell[i] = 1.0 / (nd * nm);
+  }
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::Collapse<COLLAPSE_POLICY,
+                                RAJA::ArgList<0, 1, 2, 3>,
+                                RAJA::statement::Lambda<0>>>;
+
+  while (state.KeepRunning()) {
+    RAJA::kernel<Pol>(RAJA::make_tuple(RAJA::RangeSegment(0, ng),
+                                       RAJA::RangeSegment(0, nd),
+                                       RAJA::RangeSegment(0, nz),
+                                       RAJA::RangeSegment(0, nm)),
+                      [=](int g, int d, int z, int m) {
+                        psi_m[m + nm * (z + nz * (d + nd * g))] =
+                            ell[m + nm * d] * phi[m + nm * (z + nz * g)];
+                      });
+    benchmark::DoNotOptimize(psi_m[0]);
+  }
+
+  state.SetItemsProcessed(state.iterations() * ng * nd * nz * nm);
+
+  delete[] phi;
+  delete[] ell;
+  delete[] psi_m;
+}
+
+BENCHMARK_TEMPLATE(benchmark_omp_collapse_2, RAJA::omp_parallel_collapse_exec)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_omp_collapse_2,
+                   RAJA::omp_parallel_collapse_static_exec<>)
+    ->UseRealTime();
+
+BENCHMARK_TEMPLATE(benchmark_omp_collapse_3, RAJA::omp_parallel_collapse_exec)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_omp_collapse_3,
+                   RAJA::omp_parallel_collapse_static_exec<>)
+    ->UseRealTime();
+
+BENCHMARK_TEMPLATE(benchmark_omp_collapse_4, RAJA::omp_parallel_collapse_exec)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_omp_collapse_4,
+                   RAJA::omp_parallel_collapse_static_exec<>)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_omp_collapse_4,
+                   RAJA::omp_parallel_collapse_dynamic_exec<16>)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,92 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Compares the OpenMP reduction policies as the number of threads grows.
+// Each kernel uses six reducers so the cost of combining partial results
+// at the end of the loop is visible next to the loop itself.
+//
+
+#include <omp.h>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+#define N 1000000
+
+template <typename REDUCE_POLICY>
+static void benchmark_omp_reduce(benchmark::State& state)
+{
+  const int num_threads = static_cast<int>(state.range(0));
+  const int old_num_threads = omp_get_max_threads();
+  omp_set_num_threads(num_threads);
+
+  double* a = new double[N];
+  for (int i = 0; i < N; i++) {
+    a[i] = static_cast<double>(i % 1000) - 500.0;
+  }
+
+  RAJA::ReduceSum<REDUCE_POLICY, double> sum(0.0);
+  RAJA::ReduceSum<REDUCE_POLICY, double> sum_sq(0.0);
+  RAJA::ReduceMin<REDUCE_POLICY, double> min(0.0);
+  RAJA::ReduceMax<REDUCE_POLICY, double> max(0.0);
+  RAJA::ReduceMinLoc<REDUCE_POLICY, double> minloc(0.0, -1);
+  RAJA::ReduceMaxLoc<REDUCE_POLICY, double> maxloc(0.0, -1);
+
+  while (state.KeepRunning()) {
+    sum.reset(0.0);
+    sum_sq.reset(0.0);
+    min.reset(0.0);
+    max.reset(0.0);
+    minloc.reset(0.0, -1);
+    maxloc.reset(0.0, -1);
+
+    RAJA::forall<RAJA::omp_parallel_for_exec>(RAJA::RangeSegment(0, N),
+                                              [=](int i) {
+                                                sum += a[i];
+                                                sum_sq += a[i] * a[i];
+                                                min.min(a[i]);
+                                                max.max(a[i]);
+                                                minloc.minloc(a[i], i);
+                                                maxloc.maxloc(a[i], i);
+                                              });
+
+    benchmark::DoNotOptimize(sum.get());
+    benchmark::DoNotOptimize(sum_sq.get());
+    benchmark::DoNotOptimize(min.get());
+    benchmark::DoNotOptimize(max.get());
+    benchmark::DoNotOptimize(minloc.getLoc());
+    benchmark::DoNotOptimize(maxloc.getLoc());
+  }
+
+  state.SetItemsProcessed(state.iterations() * N);
+
+  delete[] a;
+  omp_set_num_threads(old_num_threads);
+}
+
+static void thread_counts(benchmark::internal::Benchmark* b)
+{
+  const int max_threads = omp_get_max_threads();
+  for (int t = 1; t < max_threads; t *= 2) {
+    b->Arg(t);
+  }
+  b->Arg(max_threads);
+}
+
+BENCHMARK_TEMPLATE(benchmark_omp_reduce, RAJA::omp_reduce)
+    ->Apply(thread_counts)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_omp_reduce, RAJA::omp_reduce_ordered)
+    ->Apply(thread_counts)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_omp_reduce, RAJA::omp_reduce_padded)
+    ->Apply(thread_counts)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
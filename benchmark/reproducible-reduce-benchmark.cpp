@@ -0,0 +1,71 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//
+// Measures the cost of the reproducible sum reducer against omp_reduce as
+// the number of threads grows. The ratio of the two times at each thread
+// count is the overhead of getting the same sum for every thread count.
+// The data spans many orders of magnitude so that an ordinary floating
+// point sum depends on the order of the additions.
+//
+
+#include <cmath>
+
+#include <omp.h>
+
+#include "benchmark/benchmark.h"
+
+#include "RAJA/RAJA.hpp"
+
+#define N 1000000
+
+template <typename REDUCE_POLICY>
+static void benchmark_reduce_sum(benchmark::State& state)
+{
+  const int num_threads = static_cast<int>(state.range(0));
+  const int old_num_threads = omp_get_max_threads();
+  omp_set_num_threads(num_threads);
+
+  double* a = new double[N];
+  for (int i = 0; i < N; i++) {
+    a[i] = std::ldexp(static_cast<double>(i % 1000) - 499.5, i % 64 - 32);
+  }
+
+  RAJA::ReduceSum<REDUCE_POLICY, double> sum(0.0);
+
+  while (state.KeepRunning()) {
+    sum.reset(0.0);
+
+    RAJA::forall<RAJA::omp_parallel_for_exec>(RAJA::RangeSegment(0, N),
+                                              [=](int i) { sum += a[i]; });
+
+    benchmark::DoNotOptimize(sum.get());
+  }
+
+  state.SetItemsProcessed(state.iterations() * N);
+
+  delete[] a;
+  omp_set_num_threads(old_num_threads);
+}
+
+static void thread_counts(benchmark::internal::Benchmark* b)
+{
+  const int max_threads = omp_get_max_threads();
+  for (int t = 1; t < max_threads; t *= 2) {
+    b->Arg(t);
+  }
+  b->Arg(max_threads);
+}
+
+BENCHMARK_TEMPLATE(benchmark_reduce_sum, RAJA::omp_reduce)
+    ->Apply(thread_counts)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(benchmark_reduce_sum, RAJA::omp_reduce_reproducible)
+    ->Apply(thread_counts)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -192,7 +192,13 @@ macro(raja_add_benchmark)
     DEPENDS_ON ${arg_DEPENDS_ON}
     BENCHMARK On)
 
+  # each run also writes its results as JSON so they can be compared later
+  set(RAJA_BENCHMARK_RESULTS_DIR ${CMAKE_BINARY_DIR}/benchmark/results)
+  file(MAKE_DIRECTORY ${RAJA_BENCHMARK_RESULTS_DIR})
+
   blt_add_benchmark(
     NAME ${arg_NAME}
-    COMMAND ${TEST_DRIVER} ${arg_NAME})
+    COMMAND ${TEST_DRIVER} ${arg_NAME}
+            --benchmark_out=${RAJA_BENCHMARK_RESULTS_DIR}/${arg_NAME}.json
+            --benchmark_out_format=json)
 endmacro(raja_add_benchmark)
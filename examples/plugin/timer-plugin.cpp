@@ -23,14 +23,22 @@ public:
     end_time = std::chrono::steady_clock::now();
     double elapsedMs = std::chrono::duration<double, std::milli>(end_time - start_time).count();
 
+    const char* kernel = p.kernel_id ? p.kernel_id : "(unnamed)";
+
     if (p.platform == RAJA::Platform::host)
     {
-      printf("[TimerPlugin]: Elapsed time of host kernel was %f ms\n", elapsedMs);
+      printf("[TimerPlugin]: Elapsed time of host kernel %s was %f ms", kernel, elapsedMs);
     }
     else
     {
-      printf("[TimerPlugin]: Elapsed time of device kernel was %f ms\n", elapsedMs);
+      printf("[TimerPlugin]: Elapsed time of device kernel %s was %f ms", kernel, elapsedMs);
+    }
+
+    if (p.num_iterations > 0 && elapsedMs > 0.0)
+    {
+      printf(" (%zu iterations, %f iterations/ms)", p.num_iterations, p.num_iterations / elapsedMs);
     }
+    printf("\n");
   }
 
 private:
@@ -20,9 +20,15 @@
 
 #include "RAJA/config.hpp"
 
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
 
+#include "RAJA/internal/DepGraphNode.hpp"
 #include "RAJA/internal/Iterators.hpp"
 #include "RAJA/internal/RAJAVec.hpp"
 
@@ -30,6 +36,7 @@
 
 #include "RAJA/util/Operators.hpp"
 #include "RAJA/util/concepts.hpp"
+#include "RAJA/util/macros.hpp"
 
 namespace RAJA
 {
@@ -311,6 +318,26 @@ public:
     push_internal(new Tnew(val), PUSH_FRONT, PUSH_COPY);
   }
 
+  //! Add segment to back end of index set, moving from a temporary.
+  template <typename Tnew,
+            typename = typename std::enable_if<
+                !std::is_reference<Tnew>::value &&
+                !std::is_const<Tnew>::value>::type>
+  RAJA_INLINE void push_back(Tnew &&val)
+  {
+    push_internal(new Tnew(std::move(val)), PUSH_BACK, PUSH_COPY);
+  }
+
+  //! Add segment to front end of index set, moving from a temporary.
+  template <typename Tnew,
+            typename = typename std::enable_if<
+                !std::is_reference<Tnew>::value &&
+                !std::is_const<Tnew>::value>::type>
+  RAJA_INLINE void push_front(Tnew &&val)
+  {
+    push_internal(new Tnew(std::move(val)), PUSH_FRONT, PUSH_COPY);
+  }
+
   //! Return total length -- sum of lengths of all segments
   RAJA_INLINE size_t getLength() const
   {
@@ -609,6 +636,7 @@ public:
     segment_offsets = c.segment_offsets;
     segment_icounts = c.segment_icounts;
     m_len = c.m_len;
+    m_dep_graph = c.m_dep_graph;
   }
 
   //! Swap function for copy-and-swap idiom (deep copy).
@@ -619,6 +647,7 @@ public:
     swap(segment_offsets, other.segment_offsets);
     swap(segment_icounts, other.segment_icounts);
     swap(m_len, other.m_len);
+    swap(m_dep_graph, other.m_dep_graph);
   }
 
 protected:
@@ -741,7 +770,61 @@ public:
   //! Return the number of elements in the range.
   Index_type size() const { return getNumSegments(); }
 
+  //!  @name TypedIndexSet segment dependency graph methods
+  ///
+  /// Allocate a dependency graph node for each segment currently in the
+  /// index set. Nodes start with no dependencies and are set up with
+  /// getDepGraphNode() followed by a call to finalizeDependencyGraph().
+  ///
+  /// Copies of the index set share the same dependency graph.
+  ///
+  void initDependencyGraph()
+  {
+    size_t num_seg = segment_types.size();
+    m_dep_graph = std::make_shared<dep_graph_type>();
+    m_dep_graph->reserve(num_seg);
+    for (size_t i = 0; i < num_seg; ++i) {
+      m_dep_graph->emplace_back(new DepGraphNode());
+    }
+  }
+
+  ///
+  /// Check that each forward dependency refers to a segment in the
+  /// index set.
+  ///
+  void finalizeDependencyGraph()
+  {
+    if (!dependencyGraphSet()) {
+      RAJA_ABORT_OR_THROW("TypedIndexSet dependency graph not initialized");
+    }
+    int num_seg = static_cast<int>(m_dep_graph->size());
+    for (int i = 0; i < num_seg; ++i) {
+      DepGraphNode const &task = *(*m_dep_graph)[i];
+      for (int ii = 0; ii < task.numDepTasks(); ++ii) {
+        int dep = task.depTaskNum(ii);
+        if (dep < 0 || dep >= num_seg || dep == i) {
+          RAJA_ABORT_OR_THROW("TypedIndexSet dependency graph invalid task");
+        }
+      }
+    }
+  }
+
+  //! Return true if there is a dependency graph node for each segment.
+  bool dependencyGraphSet() const
+  {
+    return m_dep_graph && m_dep_graph->size() == segment_types.size();
+  }
+
+  //! Return the dependency graph node of the segment with given id.
+  DepGraphNode *getDepGraphNode(int segid) const
+  {
+    return (*m_dep_graph)[segid].get();
+  }
+  //@}
+
 private:
+  using dep_graph_type = std::vector<std::unique_ptr<DepGraphNode>>;
+
   //! Vector of segment types:    seg_index -> seg_type
   RAJA::RAJAVec<Index_type> segment_types;
 
@@ -754,6 +837,9 @@ private:
 
   //! Total length of all TypedIndexSet segments.
   Index_type m_len;
+
+  //! dependency graph nodes:    seg_index -> node
+  std::shared_ptr<dep_graph_type> m_dep_graph;
 };
 
 
@@ -20,10 +20,20 @@
 
 #include "RAJA/config.hpp"
 
+#include <cstdint>
+#include <limits>
+#include <vector>
+
 #include "RAJA/index/IndexSet.hpp"
 #include "RAJA/index/ListSegment.hpp"
 #include "RAJA/index/RangeSegment.hpp"
 
+#include "RAJA/pattern/atomic.hpp"
+#include "RAJA/pattern/forall.hpp"
+#include "RAJA/pattern/scan.hpp"
+
+#include "RAJA/util/Span.hpp"
+#include "RAJA/util/macros.hpp"
 #include "RAJA/util/types.hpp"
 
 #include "camp/resource.hpp"
@@ -61,6 +71,231 @@ void RAJASHAREDDLL_API buildIndexSetAligned(
     RAJA::Index_type range_min_length,
     RAJA::Index_type range_align);
 
+namespace detail
+{
+
+/*!
+ * \brief Return the first position p in [begin, end) at which a run of
+ *        consecutive indices starts, i.e. indices[p] != indices[p-1] + 1,
+ *        or end if there is none. Requires begin > 0.
+ *
+ *        Full blocks are tested with a branch-free compare that the
+ *        compiler vectorizes, so long runs are skipped a block at a time.
+ */
+RAJA_INLINE RAJA::Index_type find_run_start(RAJA::Index_type const* indices,
+                                            RAJA::Index_type begin,
+                                            RAJA::Index_type end)
+{
+  constexpr RAJA::Index_type block = 16;
+  for (; begin + block <= end; begin += block) {
+    int brk = 0;
+    for (RAJA::Index_type k = 0; k < block; ++k) {
+      brk |= (indices[begin + k] != indices[begin + k - 1] + 1);
+    }
+    if (brk) break;
+  }
+  for (; begin < end; ++begin) {
+    if (indices[begin] != indices[begin - 1] + 1) return begin;
+  }
+  return end;
+}
+
+/*!
+ * \brief Position of the first aligned index in the run of consecutive
+ *        indices [run_begin, run_end), relative to run_begin. The run holds
+ *        an aligned range segment if this is less than run_end - run_begin - 1.
+ */
+RAJA_INLINE RAJA::Index_type aligned_run_offset(RAJA::Index_type first_index,
+                                                RAJA::Index_type range_align)
+{
+  return (range_align - first_index % range_align) % range_align;
+}
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Generate the same index set as the non-template version above,
+ *        running each step with the given RAJA host execution policy.
+ *
+ *        The serial builder emits a range segment for the tail of each run
+ *        of consecutive indices that starts at its first aligned index, and
+ *        gathers everything between ranges into list segments. This version
+ *        finds the runs independently in fixed-size chunks of the index
+ *        array, stitches the runs that cross chunk boundaries in a short
+ *        pass over the chunks, and places every segment with one prefix sum
+ *        over the per-chunk segment counts, so the resulting segments are
+ *        identical to those of the serial builder.
+ *
+ ******************************************************************************
+ */
+template <typename EXEC_POLICY>
+void buildIndexSetAligned(
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& iset,
+    camp::resources::Resource work_res,
+    const RAJA::Index_type* const indices_in,
+    RAJA::Index_type length,
+    RAJA::Index_type range_min_length,
+    RAJA::Index_type range_align)
+{
+  using RAJA::Index_type;
+
+  if (length == 0) return;
+
+  if (length <= range_min_length) {
+    iset.push_back(ListSegment(indices_in, length, work_res));
+    return;
+  }
+
+  const Index_type chunkSize = 1 << 16;
+  const Index_type numChunks = (length + chunkSize - 1) / chunkSize;
+
+  /* first and last run start in each chunk, or -1 if it has none */
+  std::vector<Index_type> firstStartVec(numChunks);
+  std::vector<Index_type> lastStartVec(numChunks);
+  Index_type* firstStart = firstStartVec.data();
+  Index_type* lastStart = lastStartVec.data();
+
+  RAJA::forall<EXEC_POLICY>(
+      RAJA::TypedRangeSegment<Index_type>(0, numChunks), [=](Index_type c) {
+        const Index_type begin = c * chunkSize;
+        const Index_type end =
+            (begin + chunkSize < length) ? begin + chunkSize : length;
+
+        Index_type start =
+            (begin == 0) ? 0
+                         : detail::find_run_start(indices_in, begin, end);
+        firstStart[c] = (start < end) ? start : -1;
+        lastStart[c] = firstStart[c];
+        while (start < end) {
+          lastStart[c] = start;
+          start = detail::find_run_start(indices_in, start + 1, end);
+        }
+      });
+
+  /*
+   * Stitch runs across chunks: the run start following each chunk, and
+   * whether the run before the first run start in each chunk holds a range.
+   * The very first run behaves as if it followed a range.
+   */
+  std::vector<Index_type> nextStartVec(numChunks);
+  std::vector<int> prevIsRangeVec(numChunks);
+  Index_type* nextStart = nextStartVec.data();
+  int* prevIsRange = prevIsRangeVec.data();
+
+  auto isRangeRun = [=](Index_type runBegin, Index_type runEnd) {
+    return runBegin + detail::aligned_run_offset(indices_in[runBegin],
+                                                 range_align) <
+           runEnd - 1;
+  };
+
+  Index_type next = length;
+  for (Index_type c = numChunks - 1; c >= 0; --c) {
+    nextStart[c] = next;
+    if (firstStart[c] != -1) next = firstStart[c];
+  }
+
+  Index_type prev = -1;
+  for (Index_type c = 0; c < numChunks; ++c) {
+    prevIsRange[c] = (prev == -1) || (firstStart[c] != -1 &&
+                                      isRangeRun(prev, firstStart[c]));
+    if (firstStart[c] != -1) prev = lastStart[c];
+  }
+
+  /*
+   * Each run emits a list segment at its start if it follows a range and
+   * does not begin with one, and a range segment if it holds one. A segment
+   * ends where the next one starts.
+   */
+  auto forEachSegment = [=](Index_type c, Index_type* segBegin,
+                            int* segIsRange) {
+    Index_type count = 0;
+    if (firstStart[c] == -1) return count;
+
+    const Index_type end =
+        (c * chunkSize + chunkSize < length) ? c * chunkSize + chunkSize
+                                             : length;
+    int afterRange = prevIsRange[c];
+    Index_type runBegin = firstStart[c];
+    for (;;) {
+      Index_type runEnd =
+          (runBegin == lastStart[c])
+              ? nextStart[c]
+              : detail::find_run_start(indices_in, runBegin + 1, end);
+      Index_type rangeBegin =
+          runBegin +
+          detail::aligned_run_offset(indices_in[runBegin], range_align);
+      int isRange = rangeBegin < runEnd - 1;
+
+      if (afterRange && !(isRange && rangeBegin == runBegin)) {
+        if (segBegin) {
+          segBegin[count] = runBegin;
+          segIsRange[count] = 0;
+        }
+        ++count;
+      }
+      if (isRange) {
+        if (segBegin) {
+          segBegin[count] = rangeBegin;
+          segIsRange[count] = 1;
+        }
+        ++count;
+      }
+
+      if (runBegin == lastStart[c]) break;
+      afterRange = isRange;
+      runBegin = runEnd;
+    }
+    return count;
+  };
+
+  std::vector<Index_type> chunkOffsetVec(numChunks + 1, 0);
+  Index_type* chunkOffset = chunkOffsetVec.data();
+
+  RAJA::forall<EXEC_POLICY>(
+      RAJA::TypedRangeSegment<Index_type>(0, numChunks), [=](Index_type c) {
+        chunkOffset[c + 1] = forEachSegment(c, nullptr, nullptr);
+      });
+
+  for (Index_type c = 0; c < numChunks; ++c) {
+    chunkOffset[c + 1] += chunkOffset[c];
+  }
+
+  const Index_type numSegments = chunkOffset[numChunks];
+  std::vector<Index_type> segBeginVec(numSegments + 1);
+  std::vector<int> segIsRangeVec(numSegments);
+  Index_type* segBegin = segBeginVec.data();
+  int* segIsRange = segIsRangeVec.data();
+  segBegin[numSegments] = length;
+
+  RAJA::forall<EXEC_POLICY>(
+      RAJA::TypedRangeSegment<Index_type>(0, numChunks), [=](Index_type c) {
+        forEachSegment(c, segBegin + chunkOffset[c], segIsRange + chunkOffset[c]);
+      });
+
+  /* same cutoff as the serial builder */
+  Index_type docount = 1; /* zero length termination */
+  for (Index_type s = 0; s < numSegments; ++s) {
+    docount += segIsRange[s] ? 2 : 1 + segBegin[s + 1] - segBegin[s];
+  }
+
+  if (docount < (length * (range_align - 1)) / range_align) {
+    for (Index_type s = 0; s < numSegments; ++s) {
+      Index_type segLength = segBegin[s + 1] - segBegin[s];
+      if (segIsRange[s]) {
+        Index_type first = indices_in[segBegin[s]];
+        iset.push_back(RangeSegment(first, first + segLength));
+      } else {
+        iset.push_back(
+            ListSegment(&indices_in[segBegin[s]], segLength, work_res));
+      }
+    }
+  } else {
+    iset.push_back(ListSegment(indices_in, length, work_res));
+  }
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
@@ -83,6 +318,8 @@ void RAJASHAREDDLL_API buildIndexSetAligned(
  *
  *        The method chunks a fastDim x midDim x slowDim mesh into blocks that 
  *        can be dependency-scheduled, removing need for lock constructs.
+ *        For 3d meshes the index set also holds a segment dependency graph
+ *        for use with the omp_taskgraph_segit segment iteration policy.
  *
  *  \param iset reference to index set generated with range segments.
  *         Method assumes index set is empty (no segments). 
@@ -126,6 +363,342 @@ void buildLockFreeColorIndexset(
     RAJA::Index_type* elemPermutation = nullptr,
     RAJA::Index_type* ielemPermutation = nullptr);
 
+namespace detail
+{
+
+/*!
+ * \brief Bit b of the result is set if a neighbor of domain element v, i.e.
+ *        an element sharing a range-set entity with it, has color base + b.
+ */
+RAJA_INLINE std::uint64_t neighbor_color_mask(
+    RAJA::Index_type v,
+    int base,
+    RAJA::Index_type numRangePerDomain,
+    RAJA::Index_type const* domainToRange,
+    RAJA::Index_type const* rangeToDomain,
+    RAJA::Index_type const* rangeToDomainCount,
+    int const volatile* color)
+{
+  std::uint64_t used = 0;
+  for (RAJA::Index_type j = 0; j < numRangePerDomain; ++j) {
+    RAJA::Index_type id = domainToRange[v * numRangePerDomain + j];
+    RAJA::Index_type count = rangeToDomainCount[id];
+    for (RAJA::Index_type s = 0; s < count; ++s) {
+      RAJA::Index_type u = rangeToDomain[id * numRangePerDomain + s];
+      int c = (u != v) ? color[u] : -1;
+      if (c >= base && c < base + 64) {
+        used |= std::uint64_t(1) << (c - base);
+      }
+    }
+  }
+  return used;
+}
+
+/*!
+ * \brief Counting sort of the domain elements by color: on return the
+ *        elements of color c are sorted[colorDelim[c]] up to
+ *        sorted[colorDelim[c + 1]], in increasing order.
+ *
+ *        Each chunk of elements counts its colors, a scan over the counts
+ *        laid out color by color gives every chunk its place in each color,
+ *        and the chunks then scatter their elements in order.
+ */
+template <typename EXEC_POLICY>
+void sort_by_color(int const* color,
+                   RAJA::Index_type numDomain,
+                   int numColors,
+                   RAJA::Index_type* sorted,
+                   RAJA::Index_type* colorDelim)
+{
+  using RAJA::Index_type;
+  using range_type = RAJA::TypedRangeSegment<Index_type>;
+
+  const Index_type chunkSize = 1 << 12;
+  const Index_type numChunks = (numDomain + chunkSize - 1) / chunkSize;
+
+  /* counts[c * numChunks + k] is the number of elements of color c in k */
+  std::vector<Index_type> countsVec(numColors * numChunks + 1, 0);
+  Index_type* counts = countsVec.data();
+
+  RAJA::forall<EXEC_POLICY>(range_type(0, numChunks), [=](Index_type k) {
+    const Index_type end =
+        (k * chunkSize + chunkSize < numDomain) ? k * chunkSize + chunkSize
+                                                : numDomain;
+    for (Index_type v = k * chunkSize; v < end; ++v) {
+      ++counts[color[v] * numChunks + k];
+    }
+  });
+
+  RAJA::exclusive_scan_inplace<EXEC_POLICY>(
+      RAJA::make_span(counts, numColors * numChunks + 1));
+
+  RAJA::forall<EXEC_POLICY>(range_type(0, numColors + 1), [=](Index_type c) {
+    colorDelim[c] = counts[c * numChunks];
+  });
+
+  RAJA::forall<EXEC_POLICY>(range_type(0, numChunks), [=](Index_type k) {
+    const Index_type end =
+        (k * chunkSize + chunkSize < numDomain) ? k * chunkSize + chunkSize
+                                                : numDomain;
+    for (Index_type v = k * chunkSize; v < end; ++v) {
+      sorted[counts[color[v] * numChunks + k]++] = v;
+    }
+  });
+}
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Generate a lock-free "color" index set in parallel, running each
+ *        step with the given RAJA host execution policy.
+ *
+ *        Produces the same kind of index set as the non-template version
+ *        above, but colors the domain-set with a speculative greedy coloring
+ *        (Gebremedhin-Manne): every uncolored element picks a color not used
+ *        by its neighbors at the same time, then elements that ended up with
+ *        the same color as a lower-numbered neighbor are colored again in the
+ *        next round. Among the colors that are allowed, an element takes the
+ *        one with the fewest elements so far, which keeps the colors close
+ *        to the same size.
+ *
+ *        Each color becomes one segment, with its elements in increasing
+ *        order. When elemPermutation is given every segment is a range over
+ *        the permuted numbering, otherwise a color is emitted as a range
+ *        segment if it is contiguous and as a list segment if not.
+ *
+ *        As for the non-template version, no range-set entity may be
+ *        referenced by more than numRangePerDomain domain-set elements.
+ *
+ ******************************************************************************
+ */
+template <typename EXEC_POLICY>
+void buildLockFreeColorIndexset(
+    RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>& iset,
+    camp::resources::Resource work_res,
+    RAJA::Index_type const* domainToRange,
+    int numEntity,
+    int numRangePerDomain,
+    int numEntityRange,
+    RAJA::Index_type* elemPermutation = nullptr,
+    RAJA::Index_type* ielemPermutation = nullptr)
+{
+  using RAJA::Index_type;
+  using range_type = RAJA::TypedRangeSegment<Index_type>;
+  /* auto_atomic is not atomic for TBB unless OpenMP is also enabled */
+  using atomic_pol = RAJA::builtin_atomic;
+
+  const Index_type numDomain = numEntity;
+  const Index_type R = numRangePerDomain;
+
+  /* create an inverse mapping, R slots per range-set entity */
+  std::vector<Index_type> rangeToDomainVec(numEntityRange * R);
+  std::vector<Index_type> rangeToDomainCountVec(numEntityRange, 0);
+  Index_type* rangeToDomain = rangeToDomainVec.data();
+  Index_type* rangeToDomainCount = rangeToDomainCountVec.data();
+  Index_type overflow = 0;
+  Index_type* overflow_ptr = &overflow;
+
+  RAJA::forall<EXEC_POLICY>(range_type(0, numDomain * R), [=](Index_type i) {
+    Index_type id = domainToRange[i];
+    Index_type slot =
+        RAJA::atomicAdd<atomic_pol>(&rangeToDomainCount[id], Index_type(1));
+    if (slot < R) {
+      rangeToDomain[id * R + slot] = i / R;
+    } else {
+      RAJA::atomicMax<atomic_pol>(overflow_ptr, Index_type(1));
+    }
+  });
+
+  if (overflow) {
+    RAJA_ABORT_OR_THROW(
+        "buildLockFreeColorIndexset: range-set entity referenced by more "
+        "than numRangePerDomain elements");
+  }
+
+  /* a free color always exists below this, so it bounds the color count */
+  const int maxColors = static_cast<int>(R * (R - 1) + 1);
+
+  std::vector<int> colorVec(numDomain, -1);
+  std::vector<Index_type> colorSizeVec(maxColors, 0);
+  std::vector<Index_type> worksetVec(numDomain);
+  std::vector<Index_type> nextWorksetVec(numDomain);
+  int* color = colorVec.data();
+  Index_type* colorSize = colorSizeVec.data();
+  int numColors = 0;
+  int* numColors_ptr = &numColors;
+
+  int const volatile* color_read = color;
+  Index_type const volatile* colorSize_read = colorSize;
+  int const volatile* numColors_read = numColors_ptr;
+
+  Index_type* workset = worksetVec.data();
+  RAJA::forall<EXEC_POLICY>(range_type(0, numDomain),
+                            [=](Index_type i) { workset[i] = i; });
+  Index_type worksetSize = numDomain;
+
+  while (worksetSize > 0) {
+
+    /* speculatively color every element in the workset */
+    RAJA::forall<EXEC_POLICY>(range_type(0, worksetSize), [=](Index_type k) {
+      Index_type v = workset[k];
+      int knownColors = *numColors_read;
+      int chosen = -1;
+      Index_type chosenSize = 0;
+      for (int base = 0; chosen < 0 || base < knownColors; base += 64) {
+        std::uint64_t used = detail::neighbor_color_mask(
+            v, base, R, domainToRange, rangeToDomain, rangeToDomainCount,
+            color_read);
+        for (int b = 0; b < 64; ++b) {
+          if ((used >> b) & 1) {
+            continue;
+          }
+          int c = base + b;
+          if (c >= knownColors) {
+            if (chosen < 0) {
+              chosen = c;
+            }
+            break;
+          }
+          Index_type size = colorSize_read[c];
+          if (chosen < 0 || size < chosenSize) {
+            chosen = c;
+            chosenSize = size;
+          }
+        }
+      }
+      RAJA::atomicExchange<atomic_pol>(&color[v], chosen);
+      RAJA::atomicAdd<atomic_pol>(&colorSize[chosen], Index_type(1));
+      RAJA::atomicMax<atomic_pol>(numColors_ptr, chosen + 1);
+    });
+
+    /* the higher-numbered element of each conflicting pair goes again */
+    Index_type* nextWorkset = nextWorksetVec.data();
+    Index_type nextWorksetSize = 0;
+    Index_type* nextWorksetSize_ptr = &nextWorksetSize;
+    RAJA::forall<EXEC_POLICY>(range_type(0, worksetSize), [=](Index_type k) {
+      Index_type v = workset[k];
+      int c = color_read[v];
+      for (Index_type j = 0; j < R; ++j) {
+        Index_type id = domainToRange[v * R + j];
+        Index_type count = rangeToDomainCount[id];
+        for (Index_type s = 0; s < count; ++s) {
+          Index_type u = rangeToDomain[id * R + s];
+          if (u < v && color_read[u] == c) {
+            RAJA::atomicSub<atomic_pol>(&colorSize[c], Index_type(1));
+            Index_type pos =
+                RAJA::atomicAdd<atomic_pol>(nextWorksetSize_ptr, Index_type(1));
+            nextWorkset[pos] = v;
+            return;
+          }
+        }
+      }
+    });
+
+    worksetVec.swap(nextWorksetVec);
+    workset = worksetVec.data();
+    worksetSize = nextWorksetSize;
+  }
+
+  /*
+   * Colors created late, to resolve conflicts, are much smaller than the
+   * rest. Move elements out of each oversized color into the smallest
+   * allowed color that is still under the average size. The elements of one
+   * color are never neighbors, so those moving together cannot conflict.
+   * Elements only move into colors that were never oversized, so bucketing
+   * by color once up front finds every element each pass has to look at.
+   */
+  std::vector<Index_type> colorDelimVec(numColors + 1, 0);
+  Index_type* colorDelim = colorDelimVec.data();
+  detail::sort_by_color<EXEC_POLICY>(color, numDomain, numColors, workset,
+                                     colorDelim);
+
+  const Index_type target =
+      numColors > 0 ? (numDomain + numColors - 1) / numColors : 0;
+  for (int from = 0; from < numColors; ++from) {
+    if (colorSize[from] <= target) {
+      continue;
+    }
+    const Index_type begin = colorDelim[from];
+    const Index_type end = colorDelim[from + 1];
+    RAJA::forall<EXEC_POLICY>(range_type(begin, end), [=](Index_type k) {
+      Index_type v = workset[k];
+      if (colorSize_read[from] <= target) {
+        return;
+      }
+      int best = -1;
+      Index_type bestSize = 0;
+      for (int base = 0; base < numColors; base += 64) {
+        std::uint64_t used = detail::neighbor_color_mask(
+            v, base, R, domainToRange, rangeToDomain, rangeToDomainCount,
+            color_read);
+        for (int b = 0; b < 64 && base + b < numColors; ++b) {
+          int c = base + b;
+          if (((used >> b) & 1) || c == from) {
+            continue;
+          }
+          Index_type size = colorSize_read[c];
+          if (size < target && (best < 0 || size < bestSize)) {
+            best = c;
+            bestSize = size;
+          }
+        }
+      }
+      if (best < 0) {
+        return;
+      }
+      if (RAJA::atomicAdd<atomic_pol>(&colorSize[best], Index_type(1)) >=
+          target) {
+        RAJA::atomicSub<atomic_pol>(&colorSize[best], Index_type(1));
+        return;
+      }
+      if (RAJA::atomicSub<atomic_pol>(&colorSize[from], Index_type(1)) <=
+          target) {
+        RAJA::atomicAdd<atomic_pol>(&colorSize[from], Index_type(1));
+        RAJA::atomicSub<atomic_pol>(&colorSize[best], Index_type(1));
+        return;
+      }
+      RAJA::atomicExchange<atomic_pol>(&color[v], best);
+    });
+  }
+
+  /* gather the elements of each color in increasing order */
+  detail::sort_by_color<EXEC_POLICY>(color, numDomain, numColors, workset,
+                                     colorDelim);
+
+  if (elemPermutation != nullptr) {
+    /* send back permutation array, and corresponding range segments */
+    RAJA::forall<EXEC_POLICY>(range_type(0, numDomain), [=](Index_type i) {
+      elemPermutation[i] = workset[i];
+      if (ielemPermutation != nullptr) {
+        ielemPermutation[workset[i]] = i;
+      }
+    });
+    for (int c = 0; c < numColors; ++c) {
+      if (colorDelim[c] < colorDelim[c + 1]) {
+        iset.push_back(RAJA::RangeSegment(colorDelim[c], colorDelim[c + 1]));
+      }
+    }
+  } else {
+    for (int c = 0; c < numColors; ++c) {
+      Index_type begin = colorDelim[c];
+      Index_type end = colorDelim[c + 1];
+      if (begin == end) {
+        continue;
+      }
+      /* indices are sorted and unique, so this means contiguous */
+      if (workset[end - 1] - workset[begin] == end - begin - 1) {
+        iset.push_back(
+            RAJA::RangeSegment(workset[begin], workset[end - 1] + 1));
+      } else {
+        iset.push_back(
+            RAJA::ListSegment(&workset[begin], end - begin, work_res));
+      }
+    }
+  }
+}
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
@@ -57,6 +57,11 @@ namespace RAJA
  *       determined by an optional ownership enum value passed to the 
  *       constructor.
  *
+ *       An Unowned segment is a view of the caller's array: constructing or
+ *       copying it allocates nothing, so it is the cheap way to rebuild
+ *       index lists that change every time step. For a host resource an
+ *       Owned segment makes a single allocation and copy.
+ *
  * Usage:
  *
  * A common C-style loop traversal pattern using an indirection array would be:
@@ -143,7 +148,21 @@ public:
     : m_resource(resource),
       m_owned(Unowned), m_data(nullptr), m_size(container.size())
   {
-    if (m_size > 0) {
+    if (m_size > 0 && isHostResource()) {
+
+      m_data = m_resource.allocate<value_type>(m_size);
+      m_owned = Owned;
+
+      auto dest = m_data;
+      auto src = container.begin();
+      auto const end = container.end();
+      while (src != end) {
+        *dest = *src;
+        ++dest;
+        ++src;
+      }
+
+    } else if (m_size > 0) {
 
       camp::resources::Resource host_res{camp::resources::Host()};
 
@@ -167,6 +186,30 @@ public:
     }
   }
 
+  /*!
+   * \brief Construct a list segment from a container that stores its indices
+   *        contiguously, such as std::vector or RAJA::Span.
+   *
+   * \param container container of indices for segment
+   * \param resource camp resource defining memory space where index data live
+   * \param owned Owned to copy the indices as above, Unowned to use the
+   *        container's data() array in place with no allocation.
+   *
+   * With Unowned, the container data must live in the memory space of the
+   * resource and must outlive the segment and any copies of it.
+   */
+  template <typename Container,
+            typename = decltype(std::declval<const Container&>().data())>
+  TypedListSegment(const Container& container,
+                   camp::resources::Resource resource,
+                   IndexOwnership owned)
+    : m_resource(resource)
+  {
+    initIndexData(container.data(),
+                  static_cast<Index_type>(container.size()),
+                  owned);
+  }
+
   //! Disable compiler generated constructor
   TypedListSegment() = delete;
 
@@ -311,7 +354,8 @@ private:
     m_owned = container_own;
     if (m_owned == Owned) {
 
-      if ( from_copy_ctor ) {
+      // source and destination are both addressable with a single memcpy
+      if ( from_copy_ctor || isHostResource() ) {
 
         m_data = m_resource.allocate<value_type>(m_size);
         m_resource.memcpy(m_data, container, sizeof(value_type) * m_size); 
@@ -341,6 +385,11 @@ private:
     m_data = const_cast<value_type*>(container);
   }
 
+  bool isHostResource()
+  {
+    return m_resource.get_platform() == camp::resources::Platform::host;
+  }
+
 
   // Copy of camp resource passed to ctor
   camp::resources::Resource m_resource;
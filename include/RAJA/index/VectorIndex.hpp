@@ -0,0 +1,342 @@
+/*!
+ ******************************************************************************
+ *
+ * \file VectorIndex.hpp
+ *
+ * \brief  Header file containing the index and segment types used by
+ *         RAJA::vector_exec.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_VectorIndex_HPP
+#define RAJA_VectorIndex_HPP
+
+#include "RAJA/config.hpp"
+
+#include <iterator>
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/index/IndexValue.hpp"
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \class VectorIndex
+ *
+ * \brief  A run of up to VECTOR_TYPE::s_num_elem consecutive indices,
+ *         starting at *i and size() long.
+ *
+ * Only the last index of a segment is shorter than a full register. The
+ * load and store helpers pick the full-width or the partial instruction
+ * accordingly, so a loop body written against them handles the remainder
+ * without any extra code.
+ *
+ ******************************************************************************
+ */
+template <typename IDX, typename VECTOR_TYPE>
+class VectorIndex
+{
+public:
+  using index_type = IDX;
+  using vector_type = VECTOR_TYPE;
+  using element_type = typename VECTOR_TYPE::element_type;
+
+  static constexpr camp::idx_t s_num_elem = VECTOR_TYPE::s_num_elem;
+
+  RAJA_INLINE constexpr VectorIndex() : m_index(0), m_length(s_num_elem) {}
+
+  RAJA_INLINE constexpr VectorIndex(index_type index, camp::idx_t length)
+      : m_index(index), m_length(length)
+  {
+  }
+
+  //! first index in the run
+  RAJA_INLINE constexpr index_type operator*() const { return m_index; }
+
+  //! number of indices in the run
+  RAJA_INLINE constexpr camp::idx_t size() const { return m_length; }
+
+  RAJA_INLINE constexpr bool is_full() const
+  {
+    return m_length == s_num_elem;
+  }
+
+  //! lane l is ptr[*i + l]
+  RAJA_INLINE vector_type load(element_type const* ptr) const
+  {
+    vector_type v;
+    if (is_full()) {
+      v.load_packed(ptr + stripIndexType(m_index));
+    } else {
+      v.load_packed_n(ptr + stripIndexType(m_index), m_length);
+    }
+    return v;
+  }
+
+  //! lane l is ptr[(*i + l) * stride]
+  RAJA_INLINE vector_type load_strided(element_type const* ptr,
+                                       camp::idx_t stride) const
+  {
+    vector_type v;
+    if (is_full()) {
+      v.load_strided(ptr + stripIndexType(m_index) * stride, stride);
+    } else {
+      v.load_strided_n(ptr + stripIndexType(m_index) * stride,
+                       stride,
+                       m_length);
+    }
+    return v;
+  }
+
+  //! lane l is ptr[offsets[*i + l]]
+  template <typename OFFSET>
+  RAJA_INLINE vector_type gather(element_type const* ptr,
+                                 OFFSET const* offsets) const
+  {
+    vector_type v;
+    if (is_full()) {
+      v.gather(ptr, offsets + stripIndexType(m_index));
+    } else {
+      v.gather_n(ptr, offsets + stripIndexType(m_index), m_length);
+    }
+    return v;
+  }
+
+  //! ptr[*i + l] = lane l of v
+  RAJA_INLINE void store(element_type* ptr, vector_type const& v) const
+  {
+    if (is_full()) {
+      v.store_packed(ptr + stripIndexType(m_index));
+    } else {
+      v.store_packed_n(ptr + stripIndexType(m_index), m_length);
+    }
+  }
+
+  //! ptr[(*i + l) * stride] = lane l of v
+  RAJA_INLINE void store_strided(element_type* ptr,
+                                 camp::idx_t stride,
+                                 vector_type const& v) const
+  {
+    if (is_full()) {
+      v.store_strided(ptr + stripIndexType(m_index) * stride, stride);
+    } else {
+      v.store_strided_n(ptr + stripIndexType(m_index) * stride,
+                        stride,
+                        m_length);
+    }
+  }
+
+private:
+  index_type m_index;
+  camp::idx_t m_length;
+};
+
+template <typename IDX, typename VECTOR_TYPE>
+constexpr camp::idx_t VectorIndex<IDX, VECTOR_TYPE>::s_num_elem;
+
+/*!
+ ******************************************************************************
+ *
+ * \class TypedVectorRangeSegment
+ *
+ * \brief  Segment class representing the contiguous range [begin, end) split
+ *         into runs of VECTOR_TYPE::s_num_elem indices.
+ *
+ * The iterator value type is VectorIndex, and size() is the number of runs,
+ * rounded up. This is the segment that RAJA::vector_exec iterates; forall
+ * builds one from a TypedRangeSegment, kernel needs it in the segment tuple.
+ *
+ ******************************************************************************
+ */
+template <typename StorageT,
+          typename VECTOR_TYPE,
+          typename DiffT = make_signed_t<strip_index_type_t<StorageT>>>
+struct TypedVectorRangeSegment {
+
+  using value_type = VectorIndex<StorageT, VECTOR_TYPE>;
+
+  using IndexType = DiffT;
+
+  using StripStorageT = strip_index_type_t<StorageT>;
+
+  static constexpr DiffT s_num_elem = VECTOR_TYPE::s_num_elem;
+
+  class iterator
+  {
+  public:
+    using value_type = TypedVectorRangeSegment::value_type;
+    using difference_type = DiffT;
+    using pointer = value_type*;
+    using reference = value_type;
+    using iterator_category = std::random_access_iterator_tag;
+
+    constexpr iterator() = default;
+
+    RAJA_INLINE constexpr iterator(StripStorageT index, StripStorageT last)
+        : m_index(index), m_last(last)
+    {
+    }
+
+    RAJA_INLINE value_type operator*() const { return (*this)[0]; }
+
+    RAJA_INLINE value_type operator[](difference_type d) const
+    {
+      StripStorageT index = m_index + d * s_num_elem;
+      DiffT remaining = m_last - index;
+      return value_type(StorageT(index),
+                        remaining < s_num_elem ? remaining : s_num_elem);
+    }
+
+    RAJA_INLINE iterator& operator++()
+    {
+      m_index += s_num_elem;
+      return *this;
+    }
+
+    RAJA_INLINE iterator operator++(int)
+    {
+      iterator tmp(*this);
+      ++(*this);
+      return tmp;
+    }
+
+    RAJA_INLINE iterator& operator--()
+    {
+      m_index -= s_num_elem;
+      return *this;
+    }
+
+    RAJA_INLINE iterator operator--(int)
+    {
+      iterator tmp(*this);
+      --(*this);
+      return tmp;
+    }
+
+    RAJA_INLINE iterator& operator+=(difference_type d)
+    {
+      m_index += d * s_num_elem;
+      return *this;
+    }
+
+    RAJA_INLINE iterator& operator-=(difference_type d)
+    {
+      m_index -= d * s_num_elem;
+      return *this;
+    }
+
+    RAJA_INLINE iterator operator+(difference_type d) const
+    {
+      iterator tmp(*this);
+      return tmp += d;
+    }
+
+    RAJA_INLINE friend iterator operator+(difference_type d,
+                                          iterator const& rhs)
+    {
+      return rhs + d;
+    }
+
+    RAJA_INLINE iterator operator-(difference_type d) const
+    {
+      iterator tmp(*this);
+      return tmp -= d;
+    }
+
+    RAJA_INLINE difference_type operator-(iterator const& rhs) const
+    {
+      return (m_index - rhs.m_index) / s_num_elem;
+    }
+
+    RAJA_INLINE bool operator==(iterator const& rhs) const
+    {
+      return m_index == rhs.m_index;
+    }
+
+    RAJA_INLINE bool operator!=(iterator const& rhs) const
+    {
+      return m_index != rhs.m_index;
+    }
+
+    RAJA_INLINE bool operator<(iterator const& rhs) const
+    {
+      return m_index < rhs.m_index;
+    }
+
+    RAJA_INLINE bool operator>(iterator const& rhs) const
+    {
+      return m_index > rhs.m_index;
+    }
+
+    RAJA_INLINE bool operator<=(iterator const& rhs) const
+    {
+      return m_index <= rhs.m_index;
+    }
+
+    RAJA_INLINE bool operator>=(iterator const& rhs) const
+    {
+      return m_index >= rhs.m_index;
+    }
+
+  private:
+    StripStorageT m_index = 0;
+    StripStorageT m_last = 0;
+  };
+
+  RAJA_INLINE TypedVectorRangeSegment(StripStorageT begin, StripStorageT end)
+      : m_begin(begin),
+        m_end(begin > end ? begin : end)
+  {
+  }
+
+  RAJA_INLINE explicit TypedVectorRangeSegment(
+      TypedRangeSegment<StorageT, DiffT> const& seg)
+      : TypedVectorRangeSegment(stripIndexType(*seg.begin()),
+                                stripIndexType(*seg.end()))
+  {
+  }
+
+  RAJA_INLINE iterator begin() const { return iterator(m_begin, m_end); }
+
+  //! one past the last run, which may extend past end
+  RAJA_INLINE iterator end() const
+  {
+    return iterator(m_begin + size() * s_num_elem, m_end);
+  }
+
+  //! number of runs
+  RAJA_INLINE DiffT size() const
+  {
+    return (DiffT(m_end - m_begin) + s_num_elem - 1) / s_num_elem;
+  }
+
+  //! number of indices
+  RAJA_INLINE DiffT length() const { return m_end - m_begin; }
+
+private:
+  StripStorageT m_begin;
+  StripStorageT m_end;
+};
+
+template <typename StorageT, typename VECTOR_TYPE, typename DiffT>
+constexpr DiffT TypedVectorRangeSegment<StorageT, VECTOR_TYPE, DiffT>::s_num_elem;
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
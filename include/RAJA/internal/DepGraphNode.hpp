@@ -22,12 +22,18 @@
 #include "RAJA/config.hpp"
 
 #include <atomic>
+#include <condition_variable>
 #include <cstdlib>
 #include <iosfwd>
+#include <mutex>
+#include <new>
 #include <thread>
+#include <vector>
 
 #include "RAJA/util/types.hpp"
 
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
 namespace RAJA
 {
 
@@ -37,29 +43,50 @@ namespace RAJA
  * \brief  Class defining a simple semephore-based data structure for
  *         managing a node in a dependency graph.
  *
+ *         Waiting threads spin briefly and then block on a condition
+ *         variable; the thread that satisfies the last dependency only
+ *         takes the lock when a thread is actually blocked.
+ *
  ******************************************************************************
  */
 class RAJA_ALIGNED_ATTR(256) DepGraphNode
 {
 public:
   ///
-  /// Constants for total number of allowable dependent tasks
-  /// and alignment of semaphore value (should match cache
-  /// coherence page size?).
-  ///
-  /// These values may need to be set differently for different
-  /// algorithms and platforms. We haven't determined the best defaults yet!
+  /// Number of times wait() polls the semaphore before blocking.
   ///
-  static const int _MaxDepTasks_ = 8;
+  static const int _WaitSpinCount_ = 1024;
 
   ///
   /// Default ctor initializes node to default state.
   ///
   DepGraphNode()
-      : m_num_dep_tasks(0), m_semaphore_reload_value(0), m_semaphore_value(0)
+      : m_dep_task(),
+        m_semaphore_reload_value(0),
+        m_semaphore_value(0),
+        m_num_waiters(0)
   {
   }
 
+  DepGraphNode(DepGraphNode const&) = delete;
+  DepGraphNode& operator=(DepGraphNode const&) = delete;
+
+  ///
+  /// Nodes are over-aligned to keep their semaphores on separate cache lines,
+  /// allocate them with the aligned allocator instead of relying on
+  /// aligned operator new.
+  ///
+  static void* operator new(size_t size)
+  {
+    void* ptr = allocate_aligned(alignof(DepGraphNode), size);
+    if (!ptr) {
+      throw std::bad_alloc();
+    }
+    return ptr;
+  }
+
+  static void operator delete(void* ptr) { free_aligned(ptr); }
+
   ///
   /// Get/set semaphore value; i.e., the current number of (unsatisfied)
   /// dependencies that must be satisfied before this task can execute.
@@ -78,12 +105,21 @@ public:
   void reset() { m_semaphore_value.store(m_semaphore_reload_value); }
 
   ///
-  /// Satisfy one incoming dependency
+  /// Satisfy one incoming dependency and wake any waiting thread if it
+  /// was the last one.
   ///
   void satisfyOne()
   {
-    if (m_semaphore_value > 0) {
-      --m_semaphore_value;
+    int value = m_semaphore_value.load();
+    while (value > 0 &&
+           !m_semaphore_value.compare_exchange_weak(value, value - 1)) {
+    }
+
+    if (value == 1 && m_num_waiters.load() > 0) {
+      // taking the lock orders this notify after the waiter has either
+      // seen the satisfied semaphore or started waiting on the condition
+      { std::lock_guard<std::mutex> lock(m_mutex); }
+      m_condition.notify_all();
     }
   }
 
@@ -92,18 +128,33 @@ public:
   ///
   void wait()
   {
-    while (m_semaphore_value > 0) {
-      // TODO: an efficient wait would be better here, but the standard
-      // promise/future is not good enough
-      std::this_thread::yield();
+    for (int spin = 0; spin < _WaitSpinCount_; ++spin) {
+      if (m_semaphore_value.load(std::memory_order_acquire) <= 0) {
+        return;
+      }
     }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    ++m_num_waiters;
+    m_condition.wait(lock, [&]() { return m_semaphore_value.load() <= 0; });
+    --m_num_waiters;
   }
 
   ///
-  /// Get/set the number of "forward-dependencies" for this task; i.e., the
+  /// Get the number of "forward-dependencies" for this task; i.e., the
   /// number of external tasks that cannot execute until this task completes.
   ///
-  int& numDepTasks() { return m_num_dep_tasks; }
+  int numDepTasks() const { return static_cast<int>(m_dep_task.size()); }
+
+  ///
+  /// Add a forward dependency on the task with the given number.
+  ///
+  void addDepTask(int task_num) { m_dep_task.push_back(task_num); }
+
+  ///
+  /// Remove all forward dependencies of this task.
+  ///
+  void clearDepTasks() { m_dep_task.clear(); }
 
   ///
   /// Get/set the forward dependency task number associated with the given
@@ -111,6 +162,8 @@ public:
   /// dependencies when this task completes.
   ///
   int& depTaskNum(int tidx) { return m_dep_task[tidx]; }
+  ///
+  int depTaskNum(int tidx) const { return m_dep_task[tidx]; }
 
   ///
   /// Print task graph object node data to given output stream.
@@ -118,10 +171,12 @@ public:
   void print(std::ostream& os) const;
 
 private:
-  int m_dep_task[_MaxDepTasks_];
-  int m_num_dep_tasks;
+  std::vector<int> m_dep_task;
   int m_semaphore_reload_value;
   std::atomic<int> m_semaphore_value;
+  std::atomic<int> m_num_waiters;
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
 };
 
 }  // namespace RAJA
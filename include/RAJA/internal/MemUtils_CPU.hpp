@@ -23,7 +23,9 @@
 
 #include <cstddef>
 #include <cstdlib>
+#include <cstring>
 #include <memory>
+#include <vector>
 
 #include "RAJA/util/types.hpp"
 
@@ -121,6 +123,100 @@ struct FreeAlignedType : FreeAligned
   }
 };
 
+namespace detail
+{
+
+///
+/// Stack of cache-aligned host memory blocks that hands out scratch space
+/// for kernel local arrays. Space is released in the reverse order it was
+/// taken by going back to a marker, and blocks are kept for reuse until
+/// the arena is destroyed.
+///
+class HostTileArena
+{
+public:
+  //! position in the arena to release back to
+  struct marker {
+    size_t block;
+    size_t top;
+  };
+
+  static constexpr size_t min_block_size = 64 * 1024;
+
+  HostTileArena() : m_block(0), m_top(0) {}
+
+  HostTileArena(HostTileArena const&) = delete;
+  HostTileArena& operator=(HostTileArena const&) = delete;
+
+  ~HostTileArena()
+  {
+    for (block& b : m_blocks) {
+      free_aligned(b.data);
+    }
+  }
+
+  marker mark() const { return marker{m_block, m_top}; }
+
+  //! returns DATA_ALIGN aligned space for nbytes, or nullptr
+  void* allocate(size_t nbytes)
+  {
+    const size_t align = static_cast<size_t>(DATA_ALIGN);
+    nbytes = (nbytes + align - 1) / align * align;
+
+    while (m_block < m_blocks.size() &&
+           m_top + nbytes > m_blocks[m_block].size) {
+      ++m_block;
+      m_top = 0;
+    }
+
+    if (m_block == m_blocks.size()) {
+      size_t size = m_blocks.empty() ? size_t(min_block_size)
+                                     : 2 * m_blocks.back().size;
+      if (size < nbytes) {
+        size = nbytes;
+      }
+      char* data = static_cast<char*>(allocate_aligned(DATA_ALIGN, size));
+      if (data == nullptr) {
+        return nullptr;
+      }
+      // touch the pages from the thread that will use them
+      std::memset(data, 0, size);
+      m_blocks.push_back(block{data, size});
+    }
+
+    void* ptr = m_blocks[m_block].data + m_top;
+    m_top += nbytes;
+    return ptr;
+  }
+
+  void release(marker m)
+  {
+    m_block = m.block;
+    m_top = m.top;
+  }
+
+private:
+  struct block {
+    char* data;
+    size_t size;
+  };
+
+  std::vector<block> m_blocks;
+  size_t m_block;
+  size_t m_top;
+};
+
+///
+/// Tile arena of the calling thread, it persists across kernels
+///
+inline HostTileArena& get_host_tile_arena()
+{
+  static thread_local HostTileArena arena;
+  return arena;
+}
+
+}  // namespace detail
+
 }  // namespace RAJA
 
 #endif  // closing endif for header file include guard
@@ -264,7 +264,9 @@ public:
       reserve(m_max_num_loops, m_max_storage_bytes);
     }
 
-    util::PluginContext context{util::make_context<exec_policy>()};
+    util::PluginContext context{
+        util::make_context<exec_policy, camp::decay<loop_T>>(
+            RAJA::Pattern::workgroup, seg)};
     util::callPreCapturePlugins(context);
 
     using RAJA::util::trigger_updates_before;
@@ -485,7 +487,8 @@ WorkGroup<
                           ALLOCATOR_T>::resource_type r,
                       Args... args)
 {
-  util::PluginContext context{util::make_context<EXEC_POLICY_T>()};
+  util::PluginContext context{
+      util::make_context<EXEC_POLICY_T, WorkGroup>(RAJA::Pattern::workgroup)};
   util::callPreLaunchPlugins(context);
 
   // move any per run storage into worksite
@@ -19,6 +19,7 @@
 #define RAJA_PATTERN_DETAIL_REDUCE_HPP
 
 #include "RAJA/util/Operators.hpp"
+#include "RAJA/util/ReproducibleSum.hpp"
 #include "RAJA/util/types.hpp"
 
 #define RAJA_DECLARE_REDUCER(OP, POL, COMBINER)               \
@@ -50,6 +51,25 @@
   RAJA_DECLARE_REDUCER(BitOr, POL, COMBINER)           \
   RAJA_DECLARE_REDUCER(BitAnd, POL, COMBINER)
 
+#define RAJA_DECLARE_REPRODUCIBLE_SUM_REDUCER(POL, COMBINER)              \
+  template <typename T>                                                  \
+  class ReduceSum<POL, T>                                                \
+      : public reduce::detail::BaseReduceSumReproducible<T, COMBINER>    \
+  {                                                                      \
+  public:                                                                \
+    using Base = reduce::detail::BaseReduceSumReproducible<T, COMBINER>; \
+    using Base::Base;                                                    \
+  };
+
+#define RAJA_DECLARE_REPRODUCIBLE_REDUCERS(POL, COMBINER) \
+  RAJA_DECLARE_REPRODUCIBLE_SUM_REDUCER(POL, COMBINER)   \
+  RAJA_DECLARE_REDUCER(Min, POL, COMBINER)               \
+  RAJA_DECLARE_REDUCER(Max, POL, COMBINER)               \
+  RAJA_DECLARE_INDEX_REDUCER(MinLoc, POL, COMBINER)      \
+  RAJA_DECLARE_INDEX_REDUCER(MaxLoc, POL, COMBINER)      \
+  RAJA_DECLARE_REDUCER(BitOr, POL, COMBINER)             \
+  RAJA_DECLARE_REDUCER(BitAnd, POL, COMBINER)
+
 namespace RAJA
 {
 
@@ -103,6 +123,31 @@ struct and_bit : detail::op_adapter<T, RAJA::operators::bit_and> {
 #pragma omp end declare target
 #endif
 
+/*!
+ * \brief  Combines the exact accumulators of a reproducible sum, the
+ *         combined value does not depend on the order of combination.
+ */
+template <typename T>
+struct reproducible_sum {
+  using accumulator_type = RAJA::detail::ReproducibleSumAccumulator<T>;
+
+  struct operator_type {
+    accumulator_type operator()(accumulator_type lhs,
+                                accumulator_type const &rhs) const
+    {
+      lhs.merge(rhs);
+      return lhs;
+    }
+  };
+
+  static accumulator_type identity() { return accumulator_type(); }
+
+  void operator()(accumulator_type &val, accumulator_type const &v) const
+  {
+    val.merge(v);
+  }
+};
+
 namespace detail
 {
 
@@ -427,6 +472,77 @@ public:
   }
 };
 
+/*!
+ **************************************************************************
+ *
+ * \brief  Sum reducer class template whose result does not depend on the
+ *         number of threads or the order in which values are combined.
+ *
+ *         Each partial sum is an exact accumulator, see
+ *         RAJA::detail::ReproducibleSumAccumulator, and the total is
+ *         rounded once when it is read.
+ *
+ **************************************************************************
+ */
+template <typename T, template <typename, typename> class Combiner>
+class BaseReduceSumReproducible
+{
+  using Reduce = RAJA::reduce::reproducible_sum<T>;
+  using accumulator_type = typename Reduce::accumulator_type;
+  // NOTE: the _t here is to appease MSVC
+  using Combiner_t = Combiner<accumulator_type, Reduce>;
+  Combiner_t mutable c;
+
+public:
+  using value_type = T;
+  using reduce_type = RAJA::reduce::sum<T>;
+
+  BaseReduceSumReproducible() : c{accumulator_type(T()), accumulator_type()}
+  {
+  }
+
+  BaseReduceSumReproducible(T init_val, T identity_ = reduce_type::identity())
+      : c{accumulator_type(init_val), accumulator_type(identity_)}
+  {
+  }
+
+  void reset(T val, T identity_ = reduce_type::identity())
+  {
+    c.reset(accumulator_type(val), accumulator_type(identity_));
+  }
+
+  //! prohibit compiler-generated copy assignment
+  BaseReduceSumReproducible &operator=(const BaseReduceSumReproducible &) =
+      delete;
+
+  //! compiler-generated copy constructor
+  BaseReduceSumReproducible(const BaseReduceSumReproducible &copy)
+      : c(copy.c)
+  {
+  }
+
+  //! compiler-generated move constructor
+  BaseReduceSumReproducible(BaseReduceSumReproducible &&copy)
+      : c(std::move(copy.c))
+  {
+  }
+
+  void combine(T const &other) const { c.local().add(other); }
+
+  //! reducer function; updates the current instance's state
+  const BaseReduceSumReproducible &operator+=(T rhs) const
+  {
+    combine(rhs);
+    return *this;
+  }
+
+  //! Get the calculated reduced value
+  operator T() const { return get(); }
+
+  //! Get the calculated reduced value
+  T get() const { return c.get().value(); }
+};
+
 /*!
  **************************************************************************
  *
@@ -281,7 +281,9 @@ RAJA_INLINE resources::EventProxy<Res> forall_Icount(ExecutionPolicy&& p,
                 "Expected a TypedIndexSet but did not get one. Are you using "
                 "a TypedIndexSet policy by mistake?");
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  util::PluginContext context{
+      util::make_context<camp::decay<ExecutionPolicy>, camp::decay<LoopBody>>(
+          RAJA::Pattern::forall, c)};
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -331,7 +333,9 @@ forall(ExecutionPolicy&& p, Res r, IdxSet&& c, LoopBody&& loop_body)
                 "Expected a TypedIndexSet but did not get one. Are you using "
                 "a TypedIndexSet policy by mistake?");
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  util::PluginContext context{
+      util::make_context<camp::decay<ExecutionPolicy>, camp::decay<LoopBody>>(
+          RAJA::Pattern::forall, c)};
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -416,7 +420,9 @@ forall_Icount(ExecutionPolicy&& p,
   static_assert(type_traits::is_random_access_range<Container>::value,
                 "Container does not model RandomAccessIterator");
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  util::PluginContext context{
+      util::make_context<camp::decay<ExecutionPolicy>, camp::decay<LoopBody>>(
+          RAJA::Pattern::forall, c)};
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -478,7 +484,9 @@ forall(ExecutionPolicy&& p, Res r, Container&& c, LoopBody&& loop_body)
   static_assert(type_traits::is_random_access_range<Container>::value,
                 "Container does not model RandomAccessIterator");
 
-  util::PluginContext context{util::make_context<camp::decay<ExecutionPolicy>>()};
+  util::PluginContext context{
+      util::make_context<camp::decay<ExecutionPolicy>, camp::decay<LoopBody>>(
+          RAJA::Pattern::forall, c)};
   util::callPreCapturePlugins(context);
 
   using RAJA::util::trigger_updates_before;
@@ -106,7 +106,9 @@ RAJA_INLINE resources::EventProxy<Resource> kernel_param_resource(SegmentTuple &
                                                                   Resource resource,
                                                                   Bodies &&... bodies)
 {
-  util::PluginContext context{util::make_context<PolicyType>()};
+  util::PluginContext context{
+      util::make_context<PolicyType, camp::list<camp::decay<Bodies>...>>(
+          RAJA::Pattern::kernel, segments)};
 
   // TODO: test that all policy members model the Executor policy concept
   // TODO: add a static_assert for functors which cannot be invoked with
@@ -201,6 +203,7 @@ RAJA_INLINE resources::EventProxy<resources::resource_from_pol_t<PolicyType>> ke
 #include "RAJA/pattern/kernel/For.hpp"
 #include "RAJA/pattern/kernel/ForICount.hpp"
 #include "RAJA/pattern/kernel/Hyperplane.hpp"
+#include "RAJA/pattern/kernel/HyperplaneExact.hpp"
 #include "RAJA/pattern/kernel/InitLocalMem.hpp"
 #include "RAJA/pattern/kernel/Lambda.hpp"
 #include "RAJA/pattern/kernel/Param.hpp"
@@ -0,0 +1,469 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for exact-bounds hyperplane pattern executor.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_kernel_HyperplaneExact_HPP
+#define RAJA_pattern_kernel_HyperplaneExact_HPP
+
+#include "RAJA/config.hpp"
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/pattern/kernel/internal.hpp"
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+namespace RAJA
+{
+namespace statement
+{
+
+
+/*!
+ * A RAJA::kernel statement that performs hyperplane iteration over multiple
+ * indices, like statement::Hyperplane, but visits only the iterates that
+ * lie on each hyperplane.
+ *
+ * statement::Hyperplane runs ExecPolicy over the full bounding box of
+ * S1, S2, ... for every hyperplane h and discards the iterates whose
+ * i0 = h - (i1 + i2 + ...) falls outside S0. Here the bounds of i1, i2, ...
+ * are narrowed for each h so that every iterate is valid, and the
+ * iterates of a hyperplane are numbered 0 ... M(h)-1. ExecPolicy is a
+ * forall policy that is run over fixed-size chunks of that numbering, so
+ * a parallel policy gets an even share of each hyperplane regardless of
+ * its shape.
+ *
+ * The implemented loop pattern looks like:
+ *
+ *  RAJA::forall<HpExecPolicy>(RangeSegment(0, Nh), [=](RAJA::Index_type h){
+ *
+ *     RAJA::forall<ExecPolicy>(RangeSegment(0, num_chunks(h)),
+ *       [=](RAJA::Index_type chunk){
+ *
+ *          for (each (i1, i2, ...) in chunk of hyperplane h) {
+ *
+ *            RAJA::Index_type i0 = h - sum(i1, i2, ...);
+ *
+ *            loop_body(i0, i1, i2, ...);
+ *          }
+ *
+ *       });
+ *
+ *  });
+ *
+ * Hyperplanes must be visited in order, so HpExecPolicy is normally
+ * sequential. This statement is available for host execution policies.
+ *
+ */
+template <camp::idx_t HpArgumentId,
+          typename HpExecPolicy,
+          typename ArgList,
+          typename ExecPolicy,
+          typename... EnclosedStmts>
+struct HyperplaneExact
+    : public internal::Statement<ExecPolicy,
+                                 EnclosedStmts...> {
+};
+
+}  // end namespace statement
+
+namespace internal
+{
+
+//! Number of hyperplane iterates handed to each ExecPolicy iteration
+constexpr Index_type hyperplane_exact_chunk_size = 32;
+
+
+/*!
+ * The iterates of one hyperplane, stored as rows of consecutive values of
+ * the last ArgList index. Row r holds the values of the ArgList indices at
+ * its first iterate and the number of iterates in all earlier rows.
+ */
+template <size_t NumArgs>
+struct HyperplaneRows {
+
+  struct Row {
+    Index_type offset;
+    Index_type idx[NumArgs];
+  };
+
+  std::vector<Row> rows;
+  Index_type num_iterates{0};
+
+  Index_type hp_len{0};
+  Index_type arg_len[NumArgs];
+
+  // max(i_{k+1} + i_{k+2} + ...) for each ArgList index k
+  Index_type suffix_max[NumArgs];
+
+  void set_lengths(Index_type hp_length, Index_type const (&lengths)[NumArgs])
+  {
+    hp_len = hp_length;
+    Index_type sum = 0;
+    for (size_t k = NumArgs; k > 0; --k) {
+      arg_len[k - 1] = lengths[k - 1];
+      suffix_max[k - 1] = sum;
+      sum += lengths[k - 1] - 1;
+    }
+  }
+
+  //! Fill the rows for hyperplane h
+  void build(Index_type h)
+  {
+    rows.clear();
+    num_iterates = 0;
+
+    Index_type idx[NumArgs];
+    build_level(h, 0, 0, idx);
+  }
+
+  //! Index of the row containing iterate n
+  Index_type find(Index_type n) const
+  {
+    auto it = std::upper_bound(rows.begin(), rows.end(), n,
+                               [](Index_type v, Row const &row) {
+                                 return v < row.offset;
+                               });
+    return static_cast<Index_type>(it - rows.begin()) - 1;
+  }
+
+  Index_type row_end(Index_type r) const
+  {
+    return r + 1 < static_cast<Index_type>(rows.size())
+               ? rows[r + 1].offset
+               : num_iterates;
+  }
+
+private:
+  // i_k must keep i0 = h - (i1 + ... + in) in [0, hp_len) reachable
+  void build_level(Index_type h, size_t k, Index_type partial,
+                   Index_type (&idx)[NumArgs])
+  {
+    Index_type lo = h - (hp_len - 1) - partial - suffix_max[k];
+    Index_type hi = h - partial;
+    lo = lo < 0 ? 0 : lo;
+    hi = hi < arg_len[k] - 1 ? hi : arg_len[k] - 1;
+
+    if (k + 1 == NumArgs) {
+      if (lo <= hi) {
+        idx[k] = lo;
+        Row row;
+        row.offset = num_iterates;
+        std::copy(idx, idx + NumArgs, row.idx);
+        rows.push_back(row);
+        num_iterates += hi - lo + 1;
+      }
+      return;
+    }
+
+    for (Index_type i = lo; i <= hi; ++i) {
+      idx[k] = i;
+      build_level(h, k + 1, partial + i, idx);
+    }
+  }
+};
+
+
+/*!
+ * Thread-private copy of a hyperplane wrapper and its LoopData.
+ */
+template <typename T>
+struct HyperplaneExactPrivatizer {
+  using data_t = typename T::data_t;
+  using value_type = camp::decay<T>;
+  using reference_type = value_type &;
+
+  data_t privatized_data;
+  value_type privatized_wrapper;
+
+  RAJA_INLINE
+  HyperplaneExactPrivatizer(const T &o)
+      : privatized_data{o.data}, privatized_wrapper(privatized_data, o)
+  {
+  }
+
+  RAJA_INLINE
+  reference_type get_priv() { return privatized_wrapper; }
+};
+
+
+/*!
+ * Runs one chunk of the iterates of a hyperplane.
+ */
+template <camp::idx_t HpArgumentId,
+          typename ArgList,
+          typename Data,
+          typename Types,
+          typename... EnclosedStmts>
+struct HyperplaneExactChunkWrapper;
+
+template <camp::idx_t HpArgumentId,
+          camp::idx_t... Args,
+          typename Data,
+          typename Types,
+          typename... EnclosedStmts>
+struct HyperplaneExactChunkWrapper<HpArgumentId,
+                                   ArgList<Args...>,
+                                   Data,
+                                   Types,
+                                   EnclosedStmts...>
+    : public GenericWrapper<Data, Types, EnclosedStmts...> {
+
+  using Base = GenericWrapper<Data, Types, EnclosedStmts...>;
+  using data_t = typename Base::data_t;
+  using offset_tuple_t = typename data_t::offset_tuple_t;
+  using privatizer = HyperplaneExactPrivatizer<HyperplaneExactChunkWrapper>;
+
+  static constexpr size_t num_args = sizeof...(Args);
+
+  HyperplaneRows<num_args> const *plane;
+  Index_type h;
+
+  RAJA_INLINE
+  HyperplaneExactChunkWrapper(data_t &d,
+                              HyperplaneRows<num_args> const *p,
+                              Index_type hp)
+      : Base(d), plane(p), h(hp)
+  {
+  }
+
+  RAJA_INLINE
+  HyperplaneExactChunkWrapper(data_t &d, HyperplaneExactChunkWrapper const &o)
+      : Base(d), plane(o.plane), h(o.h)
+  {
+  }
+
+  template <camp::idx_t... Is>
+  RAJA_INLINE void assign_args(Index_type const (&idx)[num_args],
+                               camp::idx_seq<Is...>)
+  {
+    camp::sink((Base::data.template assign_offset<Args>(
+                    static_cast<camp::tuple_element_t<Args, offset_tuple_t>>(
+                        idx[Is])),
+                0)...);
+  }
+
+  template <typename InIndexType>
+  RAJA_INLINE void operator()(InIndexType chunk)
+  {
+    using hp_idx_t = camp::tuple_element_t<HpArgumentId, offset_tuple_t>;
+
+    Index_type n = static_cast<Index_type>(chunk) * hyperplane_exact_chunk_size;
+    Index_type n_end = n + hyperplane_exact_chunk_size;
+    n_end = n_end < plane->num_iterates ? n_end : plane->num_iterates;
+
+    // position at iterate n
+    Index_type r = plane->find(n);
+    Index_type row_end = plane->row_end(r);
+
+    Index_type idx[num_args];
+    Index_type sum = 0;
+    for (size_t k = 0; k < num_args; ++k) {
+      idx[k] = plane->rows[r].idx[k];
+      sum += idx[k];
+    }
+    idx[num_args - 1] += n - plane->rows[r].offset;
+    sum += n - plane->rows[r].offset;
+
+    for (; n < n_end; ++n) {
+
+      if (n == row_end) {
+        ++r;
+        row_end = plane->row_end(r);
+        sum = 0;
+        for (size_t k = 0; k < num_args; ++k) {
+          idx[k] = plane->rows[r].idx[k];
+          sum += idx[k];
+        }
+      }
+
+      assign_args(idx, camp::make_idx_seq_t<num_args>{});
+      Base::data.template assign_offset<HpArgumentId>(
+          static_cast<hp_idx_t>(h - sum));
+
+      Base::exec();
+
+      ++idx[num_args - 1];
+      ++sum;
+    }
+  }
+};
+
+
+/*!
+ * Runs one hyperplane: computes its rows, then runs ExecPolicy over chunks.
+ */
+template <camp::idx_t HpArgumentId,
+          typename ArgList,
+          typename ExecPolicy,
+          typename Data,
+          typename Types,
+          typename... EnclosedStmts>
+struct HyperplaneExactWrapper;
+
+template <camp::idx_t HpArgumentId,
+          camp::idx_t... Args,
+          typename ExecPolicy,
+          typename Data,
+          typename Types,
+          typename... EnclosedStmts>
+struct HyperplaneExactWrapper<HpArgumentId,
+                              ArgList<Args...>,
+                              ExecPolicy,
+                              Data,
+                              Types,
+                              EnclosedStmts...> {
+
+  using data_t = camp::decay<Data>;
+  using privatizer = HyperplaneExactPrivatizer<HyperplaneExactWrapper>;
+
+  static constexpr size_t num_args = sizeof...(Args);
+
+  data_t &data;
+
+  // rows of the current hyperplane, reused from one hyperplane to the next
+  HyperplaneRows<num_args> plane;
+
+  RAJA_INLINE
+  HyperplaneExactWrapper(data_t &d,
+                         Index_type hp_length,
+                         Index_type const (&lengths)[num_args])
+      : data(d)
+  {
+    plane.set_lengths(hp_length, lengths);
+  }
+
+  RAJA_INLINE
+  HyperplaneExactWrapper(data_t &d, HyperplaneExactWrapper const &o)
+      : data(d)
+  {
+    plane.set_lengths(o.plane.hp_len, o.plane.arg_len);
+  }
+
+  template <typename InIndexType>
+  RAJA_INLINE void operator()(InIndexType hp)
+  {
+    Index_type h = static_cast<Index_type>(hp);
+
+    plane.build(h);
+
+    Index_type num_chunks =
+        (plane.num_iterates + hyperplane_exact_chunk_size - 1) /
+        hyperplane_exact_chunk_size;
+
+    HyperplaneExactChunkWrapper<HpArgumentId,
+                                ArgList<Args...>,
+                                data_t,
+                                Types,
+                                EnclosedStmts...>
+        chunk_wrapper(data, &plane, h);
+
+    auto r = resources::get_resource<ExecPolicy>::type::get_default();
+    forall_impl(r, ExecPolicy{},
+                TypedRangeSegment<Index_type>(0, num_chunks),
+                chunk_wrapper);
+  }
+};
+
+
+template <typename Types, typename Data, camp::idx_t... Args>
+struct HyperplaneSegmentTypes {
+  using type = Types;
+};
+
+template <typename Types,
+          typename Data,
+          camp::idx_t Arg0,
+          camp::idx_t... Args>
+struct HyperplaneSegmentTypes<Types, Data, Arg0, Args...> {
+  using type = typename HyperplaneSegmentTypes<
+      setSegmentTypeFromData<Types, Arg0, Data>,
+      Data,
+      Args...>::type;
+};
+
+
+template <camp::idx_t HpArgumentId,
+          typename HpExecPolicy,
+          camp::idx_t... Args,
+          typename ExecPolicy,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<statement::HyperplaneExact<HpArgumentId,
+                                                    HpExecPolicy,
+                                                    ArgList<Args...>,
+                                                    ExecPolicy,
+                                                    EnclosedStmts...>,
+                         Types> {
+
+  static_assert(sizeof...(Args) > 0,
+                "HyperplaneExact requires at least one index in ArgList");
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &data)
+  {
+    using data_t = camp::decay<Data>;
+
+    // Set the argument types for the hyperplane and all ArgList indices
+    using NewTypes =
+        typename HyperplaneSegmentTypes<Types, Data, HpArgumentId, Args...>::
+            type;
+
+    Index_type hp_length =
+        static_cast<Index_type>(segment_length<HpArgumentId>(data));
+    Index_type lengths[sizeof...(Args)] = {
+        static_cast<Index_type>(segment_length<Args>(data))...};
+
+    // an empty segment means there is nothing to iterate over
+    Index_type min_length = hp_length;
+    for (Index_type len : lengths) {
+      min_length = len < min_length ? len : min_length;
+    }
+    if (min_length <= 0) {
+      return;
+    }
+
+    // hyperplanes h = i0 + i1 + ... run from 0 to sum(Ni - 1)
+    Index_type num_hyperplanes = hp_length;
+    for (Index_type len : lengths) {
+      num_hyperplanes += len - 1;
+    }
+
+    HyperplaneExactWrapper<HpArgumentId,
+                           ArgList<Args...>,
+                           ExecPolicy,
+                           data_t,
+                           NewTypes,
+                           EnclosedStmts...>
+        hp_wrapper(data, hp_length, lengths);
+
+    auto r = resources::get_resource<HpExecPolicy>::type::get_default();
+    forall_impl(r, HpExecPolicy{},
+                TypedRangeSegment<Index_type>(0, num_hyperplanes),
+                hp_wrapper);
+  }
+};
+
+
+}  // end namespace internal
+
+}  // end namespace RAJA
+
+#endif /* RAJA_pattern_kernel_HyperplaneExact_HPP */
@@ -23,11 +23,16 @@
 #include <iostream>
 #include <type_traits>
 
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
+#include "RAJA/util/macros.hpp"
+
 namespace RAJA
 {
 
 //Policies for RAJA local arrays
 struct cpu_tile_mem;
+struct cpu_tile_arena_mem;
 
 
 namespace statement
@@ -52,6 +57,10 @@ template<camp::idx_t... Indices, typename... EnclosedStmts>
 struct InitLocalMem<RAJA::cpu_tile_mem, camp::idx_seq<Indices...>, EnclosedStmts...> : public internal::Statement<camp::nil> {
 };
 
+template<camp::idx_t... Indices, typename... EnclosedStmts>
+struct InitLocalMem<RAJA::cpu_tile_arena_mem, camp::idx_seq<Indices...>, EnclosedStmts...> : public internal::Statement<camp::nil> {
+};
+
 
 }  // end namespace statement
 
@@ -108,6 +117,69 @@ struct StatementExecutor<statement::InitLocalMem<RAJA::cpu_tile_mem,camp::idx_se
 };
 
 
+//Statement executor to initalize RAJA local array from the tile arena
+//of the calling thread, the space is reused by later tiles and kernels
+template<camp::idx_t... Indices, typename... EnclosedStmts, typename Types>
+struct StatementExecutor<statement::InitLocalMem<RAJA::cpu_tile_arena_mem,camp::idx_seq<Indices...>, EnclosedStmts...>, Types>{
+
+  //Returns the arena to its state on construction
+  struct ArenaRelease {
+    RAJA::detail::HostTileArena &arena;
+    RAJA::detail::HostTileArena::marker marker;
+
+    ~ArenaRelease() { arena.release(marker); }
+  };
+
+  //Execute statement list
+  template<class Data>
+  static void RAJA_INLINE exec_expanded(Data && data)
+  {
+    execute_statement_list<camp::list<EnclosedStmts...>, Types>(data);
+  }
+
+  //Intialize local array
+  //Identifies type + number of elements needed
+  template<camp::idx_t Pos, camp::idx_t... others, class Data>
+  static void RAJA_INLINE exec_expanded(Data && data)
+  {
+    using varType = typename camp::tuple_element_t<Pos, typename camp::decay<Data>::param_tuple_t>::value_type;
+
+    static_assert(std::is_trivially_default_constructible<varType>::value &&
+                  std::is_trivially_destructible<varType>::value,
+                  "cpu_tile_arena_mem requires trivial local array types");
+    static_assert(alignof(varType) <= static_cast<size_t>(RAJA::DATA_ALIGN),
+                  "cpu_tile_arena_mem alignment is limited to DATA_ALIGN");
+
+    // Initialize memory
+    RAJA::detail::HostTileArena &arena = RAJA::detail::get_host_tile_arena();
+    ArenaRelease release{arena, arena.mark()};
+
+    void *ptr = arena.allocate(sizeof(varType) *
+                               camp::get<Pos>(data.param_tuple).size());
+    if (ptr == nullptr) {
+      RAJA_ABORT_OR_THROW("InitLocalMem: cpu_tile_arena_mem allocation failed");
+    }
+    camp::get<Pos>(data.param_tuple).set_data(static_cast<varType *>(ptr));
+
+    // Initialize others and execute
+    exec_expanded<others...>(data);
+
+    // Cleanup and return
+    camp::get<Pos>(data.param_tuple).set_data(nullptr);
+  }
+
+
+
+  template<typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    //Initalize local arrays + execute statements + cleanup
+    exec_expanded<Indices...>(data);
+  }
+
+};
+
+
 }  // namespace internal
 }  // end namespace RAJA
 
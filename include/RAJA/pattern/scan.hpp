@@ -26,6 +26,7 @@
 #include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/util/concepts.hpp"
 #include "RAJA/util/Operators.hpp"
+#include "RAJA/util/plugins.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
 
 namespace RAJA
@@ -71,8 +72,16 @@ inclusive_scan_inplace(ExecPolicy&& p,
   if (begin(c) == end(c)) {
     return resources::EventProxy<Res>(r);
   }
-  return impl::scan::inclusive_inplace(r, std::forward<ExecPolicy>(p),
-                                       begin(c), end(c), binop);
+  util::PluginContext context{
+      util::make_context<camp::decay<ExecPolicy>, Function>(
+          RAJA::Pattern::scan, c)};
+  util::callPreLaunchPlugins(context);
+
+  resources::EventProxy<Res> e = impl::scan::inclusive_inplace(
+      r, std::forward<ExecPolicy>(p), begin(c), end(c), binop);
+
+  util::callPostLaunchPlugins(context);
+  return e;
 }
 ///
 template <typename ExecPolicy,
@@ -135,8 +144,16 @@ exclusive_scan_inplace(ExecPolicy&& p,
   if (begin(c) == end(c)) {
     return resources::EventProxy<Res>(r);
   }
-  return impl::scan::exclusive_inplace(r, std::forward<ExecPolicy>(p),
-                                       begin(c), end(c), binop, value);
+  util::PluginContext context{
+      util::make_context<camp::decay<ExecPolicy>, Function>(
+          RAJA::Pattern::scan, c)};
+  util::callPreLaunchPlugins(context);
+
+  resources::EventProxy<Res> e = impl::scan::exclusive_inplace(
+      r, std::forward<ExecPolicy>(p), begin(c), end(c), binop, value);
+
+  util::callPostLaunchPlugins(context);
+  return e;
 }
 ///
 template <typename ExecPolicy,
@@ -210,8 +227,16 @@ inclusive_scan(ExecPolicy&& p,
   if (begin(in) == end(in)) {
     return resources::EventProxy<Res>(r);
   }
-  return impl::scan::inclusive(r, std::forward<ExecPolicy>(p),
-                               begin(in), end(in), begin(out), binop);
+  util::PluginContext context{
+      util::make_context<camp::decay<ExecPolicy>, Function>(
+          RAJA::Pattern::scan, in)};
+  util::callPreLaunchPlugins(context);
+
+  resources::EventProxy<Res> e = impl::scan::inclusive(
+      r, std::forward<ExecPolicy>(p), begin(in), end(in), begin(out), binop);
+
+  util::callPostLaunchPlugins(context);
+  return e;
 }
 ///
 template <typename ExecPolicy,
@@ -288,8 +313,17 @@ exclusive_scan(ExecPolicy&& p,
   if (begin(in) == end(in)) {
     return resources::EventProxy<Res>(r);
   }
-  return impl::scan::exclusive(r, std::forward<ExecPolicy>(p),
-                               begin(in), end(in), begin(out), binop, value);
+  util::PluginContext context{
+      util::make_context<camp::decay<ExecPolicy>, Function>(
+          RAJA::Pattern::scan, in)};
+  util::callPreLaunchPlugins(context);
+
+  resources::EventProxy<Res> e = impl::scan::exclusive(
+      r, std::forward<ExecPolicy>(p),
+      begin(in), end(in), begin(out), binop, value);
+
+  util::callPostLaunchPlugins(context);
+  return e;
 }
 ///
 template <typename ExecPolicy,
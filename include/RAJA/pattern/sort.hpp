@@ -26,6 +26,7 @@
 #include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/util/concepts.hpp"
 #include "RAJA/util/Operators.hpp"
+#include "RAJA/util/plugins.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
 
 namespace RAJA
@@ -74,8 +75,16 @@ sort(ExecPolicy&& p,
   auto N = distance(begin_it, end_it);
 
   if (N > 1) {
-    return impl::sort::unstable(r, std::forward<ExecPolicy>(p),
-                                begin_it, end_it, comp);
+    util::PluginContext context{
+        util::make_context<camp::decay<ExecPolicy>, Compare>(
+            RAJA::Pattern::sort, N)};
+    util::callPreLaunchPlugins(context);
+
+    resources::EventProxy<Res> e = impl::sort::unstable(
+        r, std::forward<ExecPolicy>(p), begin_it, end_it, comp);
+
+    util::callPostLaunchPlugins(context);
+    return e;
   } else {
     return resources::EventProxy<Res>(r);
   }
@@ -141,8 +150,16 @@ stable_sort(ExecPolicy&& p,
   auto N = distance(begin_it, end_it);
 
   if (N > 1) {
-    return impl::sort::stable(r, std::forward<ExecPolicy>(p),
-                              begin_it, end_it, comp);
+    util::PluginContext context{
+        util::make_context<camp::decay<ExecPolicy>, Compare>(
+            RAJA::Pattern::sort, N)};
+    util::callPreLaunchPlugins(context);
+
+    resources::EventProxy<Res> e = impl::sort::stable(
+        r, std::forward<ExecPolicy>(p), begin_it, end_it, comp);
+
+    util::callPostLaunchPlugins(context);
+    return e;
   } else {
     return resources::EventProxy<Res>(r);
   }
@@ -214,8 +231,16 @@ sort_pairs(ExecPolicy&& p,
   auto N = distance(begin_key, end_key);
 
   if (N > 1) {
-    return impl::sort::unstable_pairs(r, std::forward<ExecPolicy>(p),
-                                      begin_key, end_key, begin(vals), comp);
+    util::PluginContext context{
+        util::make_context<camp::decay<ExecPolicy>, Compare>(
+            RAJA::Pattern::sort, N)};
+    util::callPreLaunchPlugins(context);
+
+    resources::EventProxy<Res> e = impl::sort::unstable_pairs(
+        r, std::forward<ExecPolicy>(p), begin_key, end_key, begin(vals), comp);
+
+    util::callPostLaunchPlugins(context);
+    return e;
   } else {
     return resources::EventProxy<Res>(r);
   }
@@ -291,8 +316,16 @@ stable_sort_pairs(ExecPolicy&& p,
   auto N = distance(begin_key, end_key);
 
   if (N > 1) {
-    return impl::sort::stable_pairs(r, std::forward<ExecPolicy>(p),
-                                    begin_key, end_key, begin(vals), comp);
+    util::PluginContext context{
+        util::make_context<camp::decay<ExecPolicy>, Compare>(
+            RAJA::Pattern::sort, N)};
+    util::callPreLaunchPlugins(context);
+
+    resources::EventProxy<Res> e = impl::sort::stable_pairs(
+        r, std::forward<ExecPolicy>(p), begin_key, end_key, begin(vals), comp);
+
+    util::callPostLaunchPlugins(context);
+    return e;
   } else {
     return resources::EventProxy<Res>(r);
   }
@@ -28,6 +28,10 @@
 #include "camp/concepts.hpp"
 #include "camp/tuple.hpp"
 
+#include <atomic>
+#include <cstddef>
+#include <thread>
+
 #if defined(RAJA_DEVICE_CODE)
 #define RAJA_TEAM_SHARED __shared__
 #else
@@ -127,11 +131,25 @@ struct Lanes {
   constexpr Lanes(int i) : value(i) {}
 };
 
+//! bytes of scratchpad memory shared by the threads of each team
+struct SharedMem {
+  size_t value;
+
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  constexpr SharedMem() : value(0) {}
+
+  RAJA_INLINE
+  RAJA_HOST_DEVICE
+  constexpr SharedMem(size_t i) : value(i) {}
+};
+
 struct Resources {
 public:
   Teams teams;
   Threads threads;
   Lanes lanes;
+  SharedMem shared_mem;
   const char *kernel_name{nullptr};
 
   RAJA_INLINE
@@ -140,6 +158,15 @@ public:
   Resources(Teams in_teams, Threads in_threads, const char *in_kernel_name = nullptr)
     : teams(in_teams), threads(in_threads), kernel_name(in_kernel_name){};
 
+  Resources(Teams in_teams,
+            Threads in_threads,
+            SharedMem in_shared_mem,
+            const char *in_kernel_name = nullptr)
+    : teams(in_teams),
+      threads(in_threads),
+      shared_mem(in_shared_mem),
+      kernel_name(in_kernel_name){};
+
 private:
   RAJA_HOST_DEVICE
   RAJA_INLINE
@@ -152,6 +179,56 @@ private:
   RAJA_HOST_DEVICE
   RAJA_INLINE
   Lanes apply(Lanes const &a) { return (lanes = a); }
+
+  RAJA_HOST_DEVICE
+  RAJA_INLINE
+  SharedMem apply(SharedMem const &a) { return (shared_mem = a); }
+};
+
+/*!
+ * \brief  Barrier for the host threads that make up one team.
+ *
+ *         The last thread to arrive starts a new generation, the others
+ *         spin on the generation and yield after a while so oversubscribed
+ *         teams still make progress.
+ */
+class HostTeamBarrier
+{
+public:
+  explicit HostTeamBarrier(int num_threads)
+      : m_num_threads(num_threads), m_count(num_threads), m_generation(0)
+  {
+  }
+
+  HostTeamBarrier(HostTeamBarrier const &) = delete;
+  HostTeamBarrier &operator=(HostTeamBarrier const &) = delete;
+
+  void wait()
+  {
+    if (m_num_threads <= 1) {
+      return;
+    }
+    const unsigned generation = m_generation.load(std::memory_order_acquire);
+    if (m_count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      m_count.store(m_num_threads, std::memory_order_relaxed);
+      m_generation.fetch_add(1, std::memory_order_release);
+      return;
+    }
+    for (int spins = 0;
+         m_generation.load(std::memory_order_acquire) == generation;
+         ++spins) {
+      if (spins >= max_spins) {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+private:
+  static constexpr int max_spins = 1024;
+
+  const int m_num_threads;
+  std::atomic<int> m_count;
+  std::atomic<unsigned> m_generation;
 };
 
 
@@ -160,17 +237,66 @@ class LaunchContext : public Resources
 public:
   ExecPlace exec_place;
 
+  //! team scratchpad on the host, device code uses dynamic shared memory
+  void *shared_mem_ptr{nullptr};
+  size_t shared_mem_offset{0};
+
+  //! position of the calling host thread, set by host team launch policies
+  int host_team{0};
+  int host_num_teams{1};
+  int host_team_thread{0};
+  int host_num_team_threads{1};
+  HostTeamBarrier *host_team_barrier{nullptr};
+
   LaunchContext(Resources const &base, ExecPlace place)
       : Resources(base), exec_place(place)
   {
   }
 
+  /*!
+   * \brief  Carve count objects of type T out of the team's shared memory.
+   *
+   *         Every thread of a team must make the same sequence of calls so
+   *         they all get the same pointers. The memory is sized by the
+   *         SharedMem value of the launch Resources and is uninitialized.
+   *         Call releaseSharedMemory() at the end of each team iteration to
+   *         reuse it for the next one.
+   */
+  template <typename T>
+  RAJA_HOST_DEVICE T *getSharedMemory(size_t count)
+  {
+#if defined(RAJA_DEVICE_CODE)
+    extern __shared__ char raja_team_shared_mem[];
+    char *base = raja_team_shared_mem;
+#else
+    char *base = static_cast<char *>(shared_mem_ptr);
+#endif
+    const size_t offset =
+        (shared_mem_offset + alignof(T) - 1) / alignof(T) * alignof(T);
+    shared_mem_offset = offset + count * sizeof(T);
+#if !defined(RAJA_DEVICE_CODE)
+    if (base == nullptr || shared_mem_offset > shared_mem.value) {
+      RAJA_ABORT_OR_THROW(
+          "getSharedMemory exceeds the SharedMem of the launch or the host "
+          "launch policy has no team shared memory");
+    }
+#endif
+    return reinterpret_cast<T *>(base + offset);
+  }
+
+  //! make all of the team's shared memory available again
+  RAJA_HOST_DEVICE
+  void releaseSharedMemory() { shared_mem_offset = 0; }
 
   RAJA_HOST_DEVICE
   void teamSync()
   {
 #if defined(RAJA_DEVICE_CODE)
     __syncthreads();
+#else
+    if (host_team_barrier) {
+      host_team_barrier->wait();
+    }
 #endif
   }
 };
@@ -179,19 +305,55 @@ public:
 template <typename LAUNCH_POLICY>
 struct LaunchExecute;
 
+//! number of threads over all teams, as seen by the plugins
+RAJA_INLINE
+size_t launch_thread_count(Resources const &team_resources)
+{
+  size_t count = 1;
+  for (int d = 0; d < 3; ++d) {
+    count *= static_cast<size_t>(team_resources.teams.value[d]) *
+             static_cast<size_t>(team_resources.threads.value[d]);
+  }
+  return count;
+}
+
 template <typename POLICY_LIST, typename BODY>
 void launch(ExecPlace place, Resources const &team_resources, BODY const &body)
 {
   switch (place) {
     case HOST: {
-      using launch_t = LaunchExecute<typename POLICY_LIST::host_policy_t>;
+      using launch_pol = typename POLICY_LIST::host_policy_t;
+      util::PluginContext context{util::make_context<launch_pol, BODY>(
+          RAJA::Pattern::launch,
+          launch_thread_count(team_resources),
+          team_resources.kernel_name)};
+      context.platform = Platform::host;
+      util::callPreLaunchPlugins(context);
+
+      using launch_t = LaunchExecute<launch_pol>;
       launch_t::exec(LaunchContext(team_resources, HOST), body);
+
+      util::callPostLaunchPlugins(context);
       break;
     }
 #ifdef RAJA_DEVICE_ACTIVE
     case DEVICE: {
-      using launch_t = LaunchExecute<typename POLICY_LIST::device_policy_t>;
+      using launch_pol = typename POLICY_LIST::device_policy_t;
+      util::PluginContext context{util::make_context<launch_pol, BODY>(
+          RAJA::Pattern::launch,
+          launch_thread_count(team_resources),
+          team_resources.kernel_name)};
+#if defined(RAJA_ENABLE_CUDA)
+      context.platform = Platform::cuda;
+#elif defined(RAJA_ENABLE_HIP)
+      context.platform = Platform::hip;
+#endif
+      util::callPreLaunchPlugins(context);
+
+      using launch_t = LaunchExecute<launch_pol>;
       launch_t::exec(LaunchContext(team_resources, DEVICE), body);
+
+      util::callPostLaunchPlugins(context);
       break;
     }
 #endif
@@ -258,6 +420,40 @@ RAJA_HOST_DEVICE RAJA_INLINE void loop(CONTEXT const &ctx,
                                                        body);
 }
 
+template <typename POLICY_LIST,
+          typename CONTEXT,
+          typename SEGMENT,
+          typename BODY>
+RAJA_HOST_DEVICE RAJA_INLINE void loop(CONTEXT const &ctx,
+                                       SEGMENT const &segment0,
+                                       SEGMENT const &segment1,
+                                       SEGMENT const &segment2,
+                                       BODY const &body)
+{
+
+  LoopExecute<loop_policy<POLICY_LIST>, SEGMENT>::exec(ctx,
+                                                       segment0,
+                                                       segment1,
+                                                       segment2,
+                                                       body);
+}
+
+template <typename POLICY_LIST,
+          typename CONTEXT,
+          typename SEGMENT,
+          typename BODY>
+RAJA_HOST_DEVICE RAJA_INLINE void loop_icount(CONTEXT const &ctx,
+                                       SEGMENT const &segment0,
+                                       SEGMENT const &segment1,
+                                       BODY const &body)
+{
+
+  LoopICountExecute<loop_policy<POLICY_LIST>, SEGMENT>::exec(ctx,
+                                                          segment0,
+                                                          segment1,
+                                                          body);
+}
+
 template <typename POLICY_LIST,
           typename CONTEXT,
           typename SEGMENT,
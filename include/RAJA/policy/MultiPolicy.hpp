@@ -173,7 +173,9 @@ struct policy_invoker : public policy_invoker<index - 1, size, rest...> {
   {
     if (offset == size - index - 1) {
 
-      util::PluginContext context{util::make_context<Policy>()};
+      util::PluginContext context{
+          util::make_context<Policy, camp::decay<LoopBody>>(
+              RAJA::Pattern::forall, iter)};
       util::callPreCapturePlugins(context);
 
       using RAJA::util::trigger_updates_before;
@@ -204,7 +206,9 @@ struct policy_invoker<0, size, Policy, rest...> {
   {
     if (offset == size - 1) {
 
-      util::PluginContext context{util::make_context<Policy>()};
+      util::PluginContext context{
+          util::make_context<Policy, camp::decay<LoopBody>>(
+              RAJA::Pattern::forall, iter)};
       util::callPreCapturePlugins(context);
 
       using RAJA::util::trigger_updates_before;
@@ -48,7 +48,11 @@ enum class Pattern {
   workgroup,
   workgroup_exec,
   workgroup_order,
-  workgroup_storage
+  workgroup_storage,
+  kernel,
+  scan,
+  sort,
+  launch
 };
 
 enum class Launch { undefined, sync, async };
@@ -77,7 +77,7 @@ struct LaunchExecute<RAJA::expt::cuda_launch_t<async, 0>> {
       //
       // Setup shared memory buffers
       //
-      size_t shmem = 0;
+      size_t shmem = ctx.shared_mem.value;
 
       {
         //
@@ -146,7 +146,7 @@ struct LaunchExecute<RAJA::expt::cuda_launch_t<async, nthreads>> {
       //
       // Setup shared memory buffers
       //
-      size_t shmem = 0;
+      size_t shmem = ctx.shared_mem.value;
 
       {
         //
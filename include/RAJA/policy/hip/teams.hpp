@@ -77,7 +77,7 @@ struct LaunchExecute<RAJA::expt::hip_launch_t<async, 0>> {
       //
       // Setup shared memory buffers
       //
-      size_t shmem = 0;
+      size_t shmem = ctx.shared_mem.value;
 
       {
         //
@@ -144,7 +144,7 @@ struct LaunchExecute<RAJA::expt::hip_launch_t<async, nthreads>> {
       //
       // Setup shared memory buffers
       //
-      size_t shmem = 0;
+      size_t shmem = ctx.shared_mem.value;
 
       {
         //
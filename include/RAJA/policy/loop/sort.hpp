@@ -87,7 +87,9 @@ unstable(
     Iter end,
     Compare comp)
 {
-  detail::UnstableSorter{}(begin, end, comp);
+  if (!RAJA::detail::try_radix_sort(RAJA::detail::SequentialRadixParts{}, begin, end, comp)) {
+    detail::UnstableSorter{}(begin, end, comp);
+  }
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -105,7 +107,9 @@ stable(
     Iter end,
     Compare comp)
 {
-  detail::StableSorter{}(begin, end, comp);
+  if (!RAJA::detail::try_radix_sort(RAJA::detail::SequentialRadixParts{}, begin, end, comp)) {
+    detail::StableSorter{}(begin, end, comp);
+  }
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -124,10 +128,12 @@ unstable_pairs(
     ValIter vals_begin,
     Compare comp)
 {
-  auto begin = RAJA::zip(keys_begin, vals_begin);
-  auto end = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
-  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
-  detail::UnstableSorter{}(begin, end, RAJA::compare_first<zip_ref>(comp));
+  if (!RAJA::detail::try_radix_sort_pairs(RAJA::detail::SequentialRadixParts{}, keys_begin, keys_end, vals_begin, comp)) {
+    auto begin = RAJA::zip(keys_begin, vals_begin);
+    auto end = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
+    using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+    detail::UnstableSorter{}(begin, end, RAJA::compare_first<zip_ref>(comp));
+  }
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -146,10 +152,12 @@ stable_pairs(
     ValIter vals_begin,
     Compare comp)
 {
-  auto begin = RAJA::zip(keys_begin, vals_begin);
-  auto end = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
-  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
-  detail::StableSorter{}(begin, end, RAJA::compare_first<zip_ref>(comp));
+  if (!RAJA::detail::try_radix_sort_pairs(RAJA::detail::SequentialRadixParts{}, keys_begin, keys_end, vals_begin, comp)) {
+    auto begin = RAJA::zip(keys_begin, vals_begin);
+    auto end = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
+    using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+    detail::StableSorter{}(begin, end, RAJA::compare_first<zip_ref>(comp));
+  }
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -19,6 +19,9 @@
 #ifndef RAJA_pattern_teams_loop_HPP
 #define RAJA_pattern_teams_loop_HPP
 
+#include <memory>
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
 #include "RAJA/pattern/teams/teams_core.hpp"
 #include "RAJA/policy/loop/policy.hpp"
 
@@ -48,7 +51,22 @@ struct LaunchExecute<RAJA::expt::seq_launch_t> {
   template <typename BODY>
   static void exec(LaunchContext const &ctx, BODY const &body)
   {
-    body(ctx);
+    if (ctx.shared_mem.value == 0) {
+      body(ctx);
+      return;
+    }
+
+    // one team runs at a time so every team reuses the same scratchpad
+    std::unique_ptr<void, FreeAligned> shared_mem(allocate_aligned(
+        DATA_ALIGN,
+        RAJA_DIVIDE_CEILING_INT(ctx.shared_mem.value, DATA_ALIGN) *
+            DATA_ALIGN));
+    if (!shared_mem) {
+      RAJA_ABORT_OR_THROW("Could not allocate team shared memory");
+    }
+    LaunchContext team_ctx(ctx);
+    team_ctx.shared_mem_ptr = shared_mem.get();
+    body(team_ctx);
   }
 };
 
@@ -20,8 +20,15 @@
 
 #include "RAJA/config.hpp"
 
+#include <algorithm>
+#include <vector>
+
+#include <omp.h>
+
 #include "RAJA/policy/openmp/policy.hpp"
 
+#include "RAJA/pattern/detail/algorithm.hpp"
+
 #include "RAJA/pattern/WorkGroup/WorkRunner.hpp"
 
 
@@ -34,6 +41,9 @@ namespace detail
 /*!
  * Runs work in a storage container in order
  * and returns any per run resources
+ *
+ * All of the loops are run inside a single omp parallel region, each loop
+ * uses an omp for whose implicit barrier preserves the order of the loops
  */
 template <typename ALLOCATOR_T,
           typename INDEX_T,
@@ -45,17 +55,51 @@ struct WorkRunner<
         INDEX_T,
         Args...>
     : WorkRunnerForallOrdered<
-        RAJA::omp_parallel_for_exec,
+        RAJA::omp_for_exec,
         RAJA::omp_work,
         RAJA::ordered,
         ALLOCATOR_T,
         INDEX_T,
         Args...>
-{ };
+{
+  using base = WorkRunnerForallOrdered<
+        RAJA::omp_for_exec,
+        RAJA::omp_work,
+        RAJA::ordered,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>;
+  using base::base;
+  using per_run_storage = typename base::per_run_storage;
+
+  ///
+  /// run the loops in the given work container in order using forall
+  /// inside one parallel region instead of one region per loop
+  ///
+  template < typename WorkContainer >
+  per_run_storage run(WorkContainer const& storage,
+                      typename base::resource_type r, Args... args) const
+  {
+    per_run_storage run_storage{};
+
+    // Only start a parallel region if we have something to iterate over
+    if (storage.begin() != storage.end()) {
+#pragma omp parallel
+      {
+        base::run(storage, r, args...);
+      }
+    }
+
+    return run_storage;
+  }
+};
 
 /*!
  * Runs work in a storage container in reverse order
  * and returns any per run resources
+ *
+ * All of the loops are run inside a single omp parallel region, each loop
+ * uses an omp for whose implicit barrier preserves the order of the loops
  */
 template <typename ALLOCATOR_T,
           typename INDEX_T,
@@ -67,13 +111,206 @@ struct WorkRunner<
         INDEX_T,
         Args...>
     : WorkRunnerForallReverse<
-        RAJA::omp_parallel_for_exec,
+        RAJA::omp_for_exec,
         RAJA::omp_work,
         RAJA::reverse_ordered,
         ALLOCATOR_T,
         INDEX_T,
         Args...>
-{ };
+{
+  using base = WorkRunnerForallReverse<
+        RAJA::omp_for_exec,
+        RAJA::omp_work,
+        RAJA::reverse_ordered,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>;
+  using base::base;
+  using per_run_storage = typename base::per_run_storage;
+
+  ///
+  /// run the loops in the given work container in reverse order using forall
+  /// inside one parallel region instead of one region per loop
+  ///
+  template < typename WorkContainer >
+  per_run_storage run(WorkContainer const& storage,
+                      typename base::resource_type r, Args... args) const
+  {
+    per_run_storage run_storage{};
+
+    // Only start a parallel region if we have something to iterate over
+    if (storage.begin() != storage.end()) {
+#pragma omp parallel
+      {
+        base::run(storage, r, args...);
+      }
+    }
+
+    return run_storage;
+  }
+};
+
+
+/*!
+ * A body and segment holder for storing loops that will be executed
+ * as a contiguous piece of a flattened iteration space
+ */
+template <typename Segment_type, typename LoopBody,
+          typename index_type, typename ... Args>
+struct HoldOmpFlattenedLoop
+{
+  template < typename segment_in, typename body_in >
+  HoldOmpFlattenedLoop(segment_in&& segment, body_in&& body)
+    : m_segment(std::forward<segment_in>(segment))
+    , m_body(std::forward<body_in>(body))
+  { }
+
+  RAJA_INLINE void operator()(index_type i_begin, index_type i_end,
+                              Args... args) const
+  {
+    // privatize the loop body as each thread runs its own piece of the loop
+    LoopBody body(m_body);
+    const auto begin = m_segment.begin();
+    for ( index_type i = i_begin; i < i_end; ++i ) {
+      body(begin[i], args...);
+    }
+  }
+
+private:
+  Segment_type m_segment;
+  LoopBody m_body;
+};
+
+/*!
+ * Runs work in a storage container out of order by concatenating the
+ * iterations of all the loops into one iteration space that is split into
+ * equal contiguous pieces, one per thread, in a single omp parallel region
+ */
+template <typename ALLOCATOR_T,
+          typename INDEX_T,
+          typename ... Args>
+struct WorkRunner<
+        RAJA::omp_work,
+        RAJA::policy::omp::unordered_omp_flattened_static,
+        ALLOCATOR_T,
+        INDEX_T,
+        Args...>
+{
+  using exec_policy = RAJA::omp_work;
+  using order_policy = RAJA::policy::omp::unordered_omp_flattened_static;
+  using Allocator = ALLOCATOR_T;
+  using index_type = INDEX_T;
+  using resource_type = resources::Host;
+
+  using vtable_type = Vtable<RAJA::omp_work, index_type, index_type, Args...>;
+
+  WorkRunner() = default;
+
+  WorkRunner(WorkRunner const&) = delete;
+  WorkRunner& operator=(WorkRunner const&) = delete;
+
+  WorkRunner(WorkRunner &&) = default;
+  WorkRunner& operator=(WorkRunner &&) = default;
+
+  // The type  that will hold the segment and loop body in work storage
+  template < typename ITERABLE, typename LOOP_BODY >
+  using holder_type = HoldOmpFlattenedLoop<ITERABLE, LOOP_BODY,
+                                 index_type, Args...>;
+
+  // The policy indicating where the call function is invoked
+  // in this case the values are called on the host
+  using vtable_exec_policy = exec_policy;
+
+  // runner interfaces with storage to enqueue so the runner can get
+  // information from the segment and loop at enqueue time
+  template < typename WorkContainer, typename Iterable, typename LoopBody >
+  inline void enqueue(WorkContainer& storage, Iterable&& iter, LoopBody&& loop_body)
+  {
+    using LOOP_BODY = camp::decay<LoopBody>;
+    using ITERABLE  = camp::decay<Iterable>;
+
+    using holder = holder_type<ITERABLE, LOOP_BODY>;
+
+    const index_type len =
+        static_cast<index_type>(std::distance(std::begin(iter), std::end(iter)));
+
+    // Only store loops that have something to iterate over
+    if (len > 0) {
+
+      if (m_loop_offsets.empty()) {
+        m_loop_offsets.emplace_back(0);
+      }
+      m_loop_offsets.emplace_back(m_loop_offsets.back() + len);
+
+      storage.template emplace<holder>(
+          get_Vtable<holder, vtable_type>(vtable_exec_policy{}),
+          std::forward<Iterable>(iter), std::forward<LoopBody>(loop_body));
+    }
+  }
+
+  // no extra storage required here
+  using per_run_storage = int;
+
+  template < typename WorkContainer >
+  per_run_storage run(WorkContainer const& storage, resource_type, Args... args) const
+  {
+    using value_type = typename WorkContainer::value_type;
+
+    per_run_storage run_storage{};
+
+    const index_type num_loops =
+        static_cast<index_type>(std::distance(storage.begin(), storage.end()));
+
+    // Only start a parallel region if we have something to iterate over
+    if (num_loops > 0) {
+
+      const index_type total_iterations = m_loop_offsets.back();
+      const auto storage_begin = storage.begin();
+      const auto offsets_begin = m_loop_offsets.begin();
+      const auto offsets_end = m_loop_offsets.end();
+
+#pragma omp parallel
+      {
+        const index_type num_threads = omp_get_num_threads();
+        const index_type thread_id = omp_get_thread_num();
+
+        index_type i = RAJA::detail::firstIndex(total_iterations,
+                                                num_threads, thread_id);
+        const index_type i_end = RAJA::detail::firstIndex(total_iterations,
+                                                          num_threads, thread_id+1);
+
+        if (i < i_end) {
+
+          // find the loop that contains the first iterate of this thread
+          index_type i_loop = static_cast<index_type>(
+              std::upper_bound(offsets_begin, offsets_end, i) - offsets_begin) - 1;
+
+          for (; i < i_end; ++i_loop) {
+            const index_type loop_begin = m_loop_offsets[i_loop];
+            const index_type loop_end = m_loop_offsets[i_loop+1];
+            const index_type i_stop = (i_end < loop_end) ? i_end : loop_end;
+            value_type::call(&storage_begin[i_loop],
+                             i - loop_begin, i_stop - loop_begin, args...);
+            i = i_stop;
+          }
+        }
+      }
+    }
+
+    return run_storage;
+  }
+
+  // clear any state so ready to be destroyed or reused
+  void clear()
+  {
+    m_loop_offsets.clear();
+  }
+
+private:
+  // offset of the first iterate of each loop in the flattened iteration
+  // space followed by the total number of iterations
+  std::vector<index_type> m_loop_offsets;
+};
 
 }  // namespace detail
 
@@ -32,6 +32,7 @@
 
 #include "RAJA/util/types.hpp"
 
+#include "RAJA/internal/DepGraphNode.hpp"
 #include "RAJA/internal/fault_tolerance.hpp"
 
 #include "RAJA/index/IndexSet.hpp"
@@ -40,6 +41,7 @@
 
 #include "RAJA/policy/openmp/policy.hpp"
 
+#include "RAJA/pattern/detail/algorithm.hpp"
 #include "RAJA/pattern/forall.hpp"
 #include "RAJA/pattern/region.hpp"
 
@@ -318,6 +320,43 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host h
 //////////////////////////////////////////////////////////////////////
 //
 
+namespace internal
+{
+
+  ///
+  /// Run one segment once all of its dependencies are satisfied and then
+  /// satisfy the dependencies of the segments waiting on it.
+  ///
+  template <typename Iterable, typename Func>
+  RAJA_INLINE void taskgraph_run_segment(Iterable const& iset,
+                                         Func&& loop_body,
+                                         int isi)
+  {
+    DepGraphNode* task = iset.getDepGraphNode(isi);
+
+    task->wait();
+
+    loop_body(isi);
+
+    task->reset();
+
+    for (int ii = 0; ii < task->numDepTasks(); ++ii) {
+      iset.getDepGraphNode(task->depTaskNum(ii))->satisfyOne();
+    }
+  }
+
+  template <typename Iterable>
+  RAJA_INLINE void taskgraph_check(Iterable const& iset)
+  {
+    if (!iset.dependencyGraphSet()) {
+      std::cerr << "\n RAJA IndexSet dependency graph not set , "
+                << "FILE: " << __FILE__ << " line: " << __LINE__ << std::endl;
+      RAJA_ABORT_OR_THROW("IndexSet dependency graph");
+    }
+  }
+
+}  // namespace internal
+
 /*!
  ******************************************************************************
  *
@@ -326,59 +365,70 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host h
  *         execution policy template parameter.
  *
  *         This method assumes that a task dependency graph has been
- *         properly set up for each segment in the index set.
+ *         properly set up for each segment in the index set. Segments are
+ *         assigned to threads round-robin, so a segment may only depend on
+ *         segments with lower ids or segments owned by other threads.
  *
  ******************************************************************************
  */
-
-/*
- * TODO: Fix this!!!
- */
-
-/*
-template <typename SEG_EXEC_POLICY_T, typename LOOP_BODY, typename ...
-SEG_TYPES>
-RAJA_INLINE void forall(
-    ExecPolicy<omp_taskgraph_segit, SEG_EXEC_POLICY_T>,
-    const IndexSet<SEG_TYPES ...>& iset,
-    LOOP_BODY loop_body)
+template <typename Iterable, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host host_res,
+                                                               const omp_taskgraph_segit&,
+                                                               Iterable&& iset,
+                                                               Func&& loop_body)
 {
-  if (!iset.dependencyGraphSet()) {
-    std::cerr << "\n RAJA IndexSet dependency graph not set , "
-              << "FILE: " << __FILE__ << " line: " << __LINE__ << std::endl;
-    RAJA_ABORT_OR_THROW("IndexSet dependency graph");
-  }
+  internal::taskgraph_check(iset);
 
-  IndexSet& ncis = (*const_cast<IndexSet*>(&iset));
+  const int num_seg = static_cast<int>(iset.getNumSegments());
 
-  int num_seg = ncis.getNumSegments();
+  RAJA::region<RAJA::omp_parallel_region>([&]() {
+    using RAJA::internal::thread_privatize;
+    auto body = thread_privatize(loop_body);
+#pragma omp for schedule(static, 1)
+    for (int isi = 0; isi < num_seg; ++isi) {
+      internal::taskgraph_run_segment(iset, body.get_priv(), isi);
+    }
+  });
 
-#pragma omp parallel for schedule(static, 1)
-  for (int isi = 0; isi < num_seg; ++isi) {
-    IndexSetSegInfo* seg_info = ncis.getSegmentInfo(isi);
-    DepGraphNode* task = seg_info->getDepGraphNode();
+  return resources::EventProxy<resources::Host>(host_res);
+}
 
-    task->wait();
+/*!
+ ******************************************************************************
+ *
+ * \brief  Iterate over index set segments using an omp parallel region and
+ *         segment dependency graph where each thread runs one contiguous
+ *         interval of segments in order. Individual segment execution will
+ *         use execution policy template parameter.
+ *
+ ******************************************************************************
+ */
+template <typename Iterable, typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host host_res,
+                                                               const omp_taskgraph_interval_segit&,
+                                                               Iterable&& iset,
+                                                               Func&& loop_body)
+{
+  internal::taskgraph_check(iset);
 
-    executeRangeList_forall<SEG_EXEC_POLICY_T>(seg_info, loop_body);
+  const int num_seg = static_cast<int>(iset.getNumSegments());
 
-    task->reset();
+  RAJA::region<RAJA::omp_parallel_region>([&]() {
+    using RAJA::internal::thread_privatize;
+    auto body = thread_privatize(loop_body);
 
-    if (task->numDepTasks() != 0) {
-      for (int ii = 0; ii < task->numDepTasks(); ++ii) {
-        // Alternateively, we could get the return value of this call
-        // and actively launch the task if we are the last depedent
-        // task. In that case, we would not need the semaphore spin
-        // loop above.
-        int seg = task->depTaskNum(ii);
-        DepGraphNode* dep = ncis.getSegmentInfo(seg)->getDepGraphNode();
-        dep->satisfyOne();
-      }
+    const int num_threads = omp_get_num_threads();
+    const int thread_id = omp_get_thread_num();
+    const int isi_begin = RAJA::detail::firstIndex(num_seg, num_threads, thread_id);
+    const int isi_end = RAJA::detail::firstIndex(num_seg, num_threads, thread_id + 1);
+
+    for (int isi = isi_begin; isi < isi_end; ++isi) {
+      internal::taskgraph_run_segment(iset, body.get_priv(), isi);
     }
+  });
 
-  }  // iterate over segments of index set
+  return resources::EventProxy<resources::Host>(host_res);
 }
-*/
 
 }  // namespace omp
 
@@ -30,6 +30,9 @@
 #include "RAJA/util/macros.hpp"
 #include "RAJA/util/types.hpp"
 
+#include "RAJA/index/RangeSegment.hpp"
+
+#include "RAJA/policy/openmp/forall.hpp"
 #include "RAJA/policy/openmp/policy.hpp"
 
 namespace RAJA
@@ -41,6 +44,40 @@ struct omp_parallel_collapse_exec
                             RAJA::policy::omp::For> {
 };
 
+///
+///  Collapse policy for any number of loops that applies an OpenMP
+///  'schedule( )' to the collapsed outer loops.
+///
+template <typename Sched>
+struct omp_parallel_collapse_schedule_exec
+    : make_policy_pattern_t<RAJA::Policy::openmp,
+                            RAJA::Pattern::forall,
+                            RAJA::policy::omp::For,
+                            Sched> {
+  static_assert(std::is_base_of<::RAJA::policy::omp::internal::ScheduleTag,
+                                Sched>::value,
+                "Schedule type must be one of: Auto|Runtime|Static|Dynamic|Guided");
+};
+
+///
+template <int ChunkSize = policy::omp::default_chunk_size>
+using omp_parallel_collapse_static_exec =
+    omp_parallel_collapse_schedule_exec<policy::omp::Static<ChunkSize>>;
+
+///
+template <int ChunkSize = policy::omp::default_chunk_size>
+using omp_parallel_collapse_dynamic_exec =
+    omp_parallel_collapse_schedule_exec<policy::omp::Dynamic<ChunkSize>>;
+
+///
+template <int ChunkSize = policy::omp::default_chunk_size>
+using omp_parallel_collapse_guided_exec =
+    omp_parallel_collapse_schedule_exec<policy::omp::Guided<ChunkSize>>;
+
+///
+using omp_parallel_collapse_runtime_exec =
+    omp_parallel_collapse_schedule_exec<policy::omp::Runtime>;
+
 namespace internal
 {
 
@@ -129,8 +166,167 @@ struct StatementExecutor<statement::Collapse<omp_parallel_collapse_exec,
 };
 
 
+/////////
+// Collapsing any number of loops
+/////////
 
+//! segment types after setting the type of each collapsed argument
+template <typename Types, typename Data, camp::idx_t... Args>
+struct CollapseSegmentTypes {
+  using type = Types;
+};
 
+template <typename Types,
+          typename Data,
+          camp::idx_t Arg0,
+          camp::idx_t... Args>
+struct CollapseSegmentTypes<Types, Data, Arg0, Args...> {
+  using type = typename CollapseSegmentTypes<
+      setSegmentTypeFromData<Types, Arg0, Data>,
+      Data,
+      Args...>::type;
+};
+
+//! the last (innermost) argument of an ArgList
+template <camp::idx_t... Args>
+constexpr camp::idx_t collapse_innermost_arg()
+{
+  camp::idx_t args[] = {Args...};
+  return args[sizeof...(Args) - 1];
+}
+
+/*!
+ * \brief  Collapses the loops over all but the innermost argument into one
+ *         iteration space that is distributed with an OpenMP 'for
+ *         schedule( )'.
+ *
+ *         The offsets of the outer arguments are computed and assigned once
+ *         per outer iteration; the innermost loop runs sequentially and only
+ *         assigns its own offset. When there is a single loop, or the
+ *         product of the outer loop lengths is smaller than the number of
+ *         threads, the innermost loop is collapsed into the scheduled space
+ *         too and every iteration computes all of its offsets.
+ */
+template <typename Sched,
+          camp::idx_t... Args,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::Collapse<omp_parallel_collapse_schedule_exec<Sched>,
+                        ArgList<Args...>,
+                        EnclosedStmts...>,
+    Types> {
+
+  static constexpr size_t num_args = sizeof...(Args);
+  static constexpr camp::idx_t inner_arg = collapse_innermost_arg<Args...>();
+
+  template <typename Data, camp::idx_t... Dims>
+  static RAJA_INLINE void assign_offsets(Data& data,
+                                         Index_type const* offsets,
+                                         camp::idx_seq<Dims...>)
+  {
+    camp::sink((data.template assign_offset<Args>(offsets[Dims]), 0)...);
+  }
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data&& data)
+  {
+    static_assert(num_args > 0, "Collapse requires at least one argument");
+
+    const Index_type lengths[num_args] = {
+        static_cast<Index_type>(segment_length<Args>(data))...};
+
+    Index_type num_outer = 1;
+    for (size_t d = 0; d < num_args; ++d) {
+      if (lengths[d] <= 0) {
+        return;
+      }
+      if (d + 1 < num_args) {
+        num_outer *= lengths[d];
+      }
+    }
+    const Index_type num_inner = lengths[num_args - 1];
+
+    // Set the argument types for this loop
+    using NewTypes =
+        typename CollapseSegmentTypes<Types, camp::decay<Data>, Args...>::type;
+
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(data);
+
+    if (num_args == 1 || num_outer < omp_get_max_threads()) {
+#pragma omp parallel firstprivate(privatizer)
+      {
+        auto& private_data = privatizer.get_priv();
+        RAJA::policy::omp::internal::forall_impl(
+            Sched{},
+            TypedRangeSegment<Index_type>(0, num_outer * num_inner),
+            [&](Index_type flat) {
+              Index_type offsets[num_args];
+              for (size_t d = num_args; d > 0; --d) {
+                offsets[d - 1] = flat % lengths[d - 1];
+                flat /= lengths[d - 1];
+              }
+              assign_offsets(private_data,
+                             offsets,
+                             camp::make_idx_seq_t<num_args>{});
+              execute_statement_list<camp::list<EnclosedStmts...>, NewTypes>(
+                  private_data);
+            });
+      }
+      return;
+    }
+
+#pragma omp parallel firstprivate(privatizer)
+    {
+      auto& private_data = privatizer.get_priv();
+      RAJA::policy::omp::internal::forall_impl(
+          Sched{},
+          TypedRangeSegment<Index_type>(0, num_outer),
+          [&](Index_type outer) {
+            Index_type offsets[num_args];
+            offsets[num_args - 1] = 0;
+            for (size_t d = num_args - 1; d > 0; --d) {
+              offsets[d - 1] = outer % lengths[d - 1];
+              outer /= lengths[d - 1];
+            }
+            assign_offsets(private_data,
+                           offsets,
+                           camp::make_idx_seq_t<num_args>{});
+
+            for (Index_type i = 0; i < num_inner; ++i) {
+              private_data.template assign_offset<inner_arg>(i);
+              execute_statement_list<camp::list<EnclosedStmts...>, NewTypes>(
+                  private_data);
+            }
+          });
+    }
+  }
+};
+
+/*!
+ * \brief  omp_parallel_collapse_exec for more than three loops, uses the
+ *         implementation's default schedule.
+ */
+template <camp::idx_t Arg0,
+          camp::idx_t Arg1,
+          camp::idx_t Arg2,
+          camp::idx_t Arg3,
+          camp::idx_t... Args,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::Collapse<omp_parallel_collapse_exec,
+                        ArgList<Arg0, Arg1, Arg2, Arg3, Args...>,
+                        EnclosedStmts...>,
+    Types>
+    : StatementExecutor<
+          statement::Collapse<
+              omp_parallel_collapse_schedule_exec<policy::omp::Auto>,
+              ArgList<Arg0, Arg1, Arg2, Arg3, Args...>,
+              EnclosedStmts...>,
+          Types> {
+};
 
 }  // namespace internal
 }  // namespace RAJA
@@ -0,0 +1,271 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing the OpenMP pipelined wavefront
+ *          executor for hyperplane statements.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_openmp_kernel_hyperplane_HPP
+#define RAJA_policy_openmp_kernel_hyperplane_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "RAJA/pattern/detail/privatizer.hpp"
+
+#include "RAJA/pattern/kernel/Hyperplane.hpp"
+#include "RAJA/pattern/kernel/HyperplaneExact.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/openmp/kernel/Collapse.hpp"
+#include "RAJA/policy/openmp/policy.hpp"
+
+namespace RAJA
+{
+
+///
+///  HpExecPolicy for statement::Hyperplane and statement::HyperplaneExact
+///  that runs the sweep as a pipelined wavefront in one OpenMP parallel
+///  region, with no barrier between hyperplanes.
+///
+///  The iteration space of the hyperplane index and the ArgList indices is
+///  cut into tiles of TileSize iterates per index. Threads claim tiles in
+///  hyperplane order; a tile starts as soon as the tile before it along
+///  each index has finished, which the thread detects by waiting on that
+///  tile's completion flag. The iterates of a tile run on one thread in
+///  lexicographic order, so the statement's ExecPolicy is not used.
+///
+///  Each iterate may only depend on iterates whose indices are no larger
+///  in every position, as in a transport sweep or a Gauss-Seidel style
+///  stencil; those are the dependencies the tile order preserves.
+///
+template <camp::idx_t TileSize>
+struct omp_parallel_wavefront_exec
+    : make_policy_pattern_t<RAJA::Policy::openmp,
+                            RAJA::Pattern::forall,
+                            RAJA::policy::omp::For> {
+  static_assert(TileSize > 0,
+                "omp_parallel_wavefront_exec tile size must be positive");
+};
+
+namespace internal
+{
+
+//! Wait until a wavefront tile has published its completion
+RAJA_INLINE void omp_wavefront_wait(std::atomic<int> const& done)
+{
+  int spins = 0;
+  while (done.load(std::memory_order_acquire) == 0) {
+    if (++spins > 1024) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+/*!
+ * \brief  Pipelined tiled wavefront over the indices Args..., the first of
+ *         which is the hyperplane index.
+ */
+template <camp::idx_t TileSize,
+          typename ArgList,
+          typename Types,
+          typename... EnclosedStmts>
+struct OmpWavefrontExecutor;
+
+template <camp::idx_t TileSize,
+          camp::idx_t... Args,
+          typename Types,
+          typename... EnclosedStmts>
+struct OmpWavefrontExecutor<TileSize,
+                            ArgList<Args...>,
+                            Types,
+                            EnclosedStmts...> {
+
+  static constexpr size_t num_dims = sizeof...(Args);
+  static constexpr camp::idx_t inner_arg = collapse_innermost_arg<Args...>();
+
+  template <typename Data, camp::idx_t... Dims>
+  static RAJA_INLINE void assign_offsets(Data& data,
+                                         Index_type const* offsets,
+                                         camp::idx_seq<Dims...>)
+  {
+    camp::sink((data.template assign_offset<Args>(offsets[Dims]), 0)...);
+  }
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data&& data)
+  {
+    constexpr Index_type tile_size = TileSize;
+
+    const Index_type lengths[num_dims] = {
+        static_cast<Index_type>(segment_length<Args>(data))...};
+
+    // tiles are numbered row-major, the last index varying fastest
+    Index_type num_tiles[num_dims];
+    Index_type tile_stride[num_dims];
+    Index_type total_tiles = 1;
+    Index_type num_tile_planes = 1;
+    for (size_t d = num_dims; d > 0; --d) {
+      if (lengths[d - 1] <= 0) {
+        return;
+      }
+      num_tiles[d - 1] = (lengths[d - 1] + tile_size - 1) / tile_size;
+      tile_stride[d - 1] = total_tiles;
+      total_tiles *= num_tiles[d - 1];
+      num_tile_planes += num_tiles[d - 1] - 1;
+    }
+
+    // order the tiles by tile hyperplane, so every tile comes after the
+    // tiles it waits on
+    std::vector<Index_type> tile_plane(total_tiles);
+    std::vector<Index_type> plane_start(num_tile_planes + 1, 0);
+    for (Index_type t = 0; t < total_tiles; ++t) {
+      Index_type plane = 0;
+      for (size_t d = 0; d < num_dims; ++d) {
+        plane += (t / tile_stride[d]) % num_tiles[d];
+      }
+      tile_plane[t] = plane;
+      ++plane_start[plane + 1];
+    }
+    for (Index_type p = 0; p < num_tile_planes; ++p) {
+      plane_start[p + 1] += plane_start[p];
+    }
+    std::vector<Index_type> order(total_tiles);
+    for (Index_type t = 0; t < total_tiles; ++t) {
+      order[plane_start[tile_plane[t]]++] = t;
+    }
+
+    std::unique_ptr<std::atomic<int>[]> done(
+        new std::atomic<int>[total_tiles]);
+    for (Index_type t = 0; t < total_tiles; ++t) {
+      done[t].store(0, std::memory_order_relaxed);
+    }
+    std::atomic<Index_type> next_tile{0};
+
+    // Set the argument types for this loop
+    using NewTypes =
+        typename HyperplaneSegmentTypes<Types, camp::decay<Data>, Args...>::type;
+
+    using RAJA::internal::thread_privatize;
+    auto privatizer = thread_privatize(data);
+#pragma omp parallel firstprivate(privatizer)
+    {
+      auto& private_data = privatizer.get_priv();
+
+      for (Index_type k = next_tile.fetch_add(1, std::memory_order_relaxed);
+           k < total_tiles;
+           k = next_tile.fetch_add(1, std::memory_order_relaxed)) {
+
+        const Index_type tile = order[k];
+
+        Index_type first[num_dims];
+        Index_type last[num_dims];
+        for (size_t d = 0; d < num_dims; ++d) {
+          const Index_type coord = (tile / tile_stride[d]) % num_tiles[d];
+          if (coord > 0) {
+            omp_wavefront_wait(done[tile - tile_stride[d]]);
+          }
+          first[d] = coord * tile_size;
+          last[d] = first[d] + tile_size < lengths[d] ? first[d] + tile_size
+                                                       : lengths[d];
+        }
+
+        // run the tile lexicographically, the last index innermost
+        Index_type offsets[num_dims];
+        for (size_t d = 0; d < num_dims; ++d) {
+          offsets[d] = first[d];
+        }
+        bool more = true;
+        while (more) {
+          assign_offsets(private_data,
+                         offsets,
+                         camp::make_idx_seq_t<num_dims>{});
+
+          for (Index_type i = first[num_dims - 1]; i < last[num_dims - 1];
+               ++i) {
+            private_data.template assign_offset<inner_arg>(i);
+            execute_statement_list<camp::list<EnclosedStmts...>, NewTypes>(
+                private_data);
+          }
+
+          more = false;
+          for (size_t d = num_dims - 1; d > 0; --d) {
+            if (++offsets[d - 1] < last[d - 1]) {
+              more = true;
+              break;
+            }
+            offsets[d - 1] = first[d - 1];
+          }
+        }
+
+        done[tile].store(1, std::memory_order_release);
+      }
+    }
+  }
+};
+
+
+template <camp::idx_t HpArgumentId,
+          camp::idx_t TileSize,
+          camp::idx_t... Args,
+          typename ExecPolicy,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::Hyperplane<HpArgumentId,
+                          omp_parallel_wavefront_exec<TileSize>,
+                          ArgList<Args...>,
+                          ExecPolicy,
+                          EnclosedStmts...>,
+    Types>
+    : OmpWavefrontExecutor<TileSize,
+                           ArgList<HpArgumentId, Args...>,
+                           Types,
+                           EnclosedStmts...> {
+};
+
+template <camp::idx_t HpArgumentId,
+          camp::idx_t TileSize,
+          camp::idx_t... Args,
+          typename ExecPolicy,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::HyperplaneExact<HpArgumentId,
+                               omp_parallel_wavefront_exec<TileSize>,
+                               ArgList<Args...>,
+                               ExecPolicy,
+                               EnclosedStmts...>,
+    Types>
+    : OmpWavefrontExecutor<TileSize,
+                           ArgList<HpArgumentId, Args...>,
+                           Types,
+                           EnclosedStmts...> {
+};
+
+}  // namespace internal
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_OPENMP guard
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,119 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for OpenMP kernel reduction executors.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_openmp_kernel_Reduce_HPP
+#define RAJA_policy_openmp_kernel_Reduce_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP)
+
+#include <omp.h>
+
+#include "RAJA/pattern/detail/reduce.hpp"
+#include "RAJA/pattern/kernel/Reduce.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+
+#include "RAJA/policy/openmp/policy.hpp"
+#include "RAJA/policy/openmp/reduce.hpp"
+
+namespace RAJA
+{
+
+namespace internal
+{
+
+//
+// Executor that handles reductions across the threads of an OpenMP
+// parallel region.
+//
+// Each thread accumulates into the Param in its private copy of the loop
+// data, e.g. in a statement::For with an omp_for_nowait policy inside a
+// statement::Region<omp_parallel_region>. When all threads of the region
+// reach this statement the Param values are combined in thread order,
+// thread 0 gets the result and only thread 0 executes the enclosed
+// statements. All threads of the region must execute this statement, so
+// it must not be nested inside a work-shared loop or another Reduce. To
+// reduce several Params use one Reduce after another, thread 0 holds all
+// of the reduced values in the enclosed statements of the last one.
+//
+template <template <typename...> class ReduceOperator,
+          typename ParamId,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::Reduce<omp_reduce, ReduceOperator, ParamId, EnclosedStmts...>, Types> {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    const int num_threads = omp_get_num_threads();
+
+    if (num_threads > 1) {
+      using value_t = camp::decay<decltype(data.template get_param<ParamId>())>;
+      using combiner_t =
+          RAJA::reduce::detail::op_adapter<value_t, ReduceOperator>;
+
+      using slot_t = RAJA::detail::OMPReduceSlot<value_t>;
+
+      const int tid = omp_get_thread_num();
+
+      // one padded slot per thread shared by the team, drawn from the
+      // reducer slot pool so a warm pool does not touch the heap
+      slot_t *slots = nullptr;
+#pragma omp single copyprivate(slots)
+      {
+        slots = RAJA::detail::get_omp_reduce_slot_mempool()
+                    .template malloc<slot_t>(num_threads);
+      }
+      if (!slots) {
+        RAJA_ABORT_OR_THROW("kernel omp_reduce: slot allocation failed");
+      }
+
+      new (&slots[tid]) slot_t{data.template get_param<ParamId>()};
+
+#pragma omp barrier
+
+      if (tid != 0) {
+        return;
+      }
+
+      value_t value = slots[0].value;
+      for (int t = 1; t < num_threads; ++t) {
+        combiner_t{}(value, slots[t].value);
+      }
+      for (int t = 0; t < num_threads; ++t) {
+        slots[t].~slot_t();
+      }
+      RAJA::detail::get_omp_reduce_slot_mempool().free(slots);
+
+      data.template assign_param<ParamId>(value);
+    }
+
+    // the calling thread now holds the reduced value
+    execute_statement_list<camp::list<EnclosedStmts...>, Types>(data);
+  }
+};
+
+
+}  // namespace internal
+
+}  // end namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_OPENMP guard
+
+#endif  // closing endif for header file include guard
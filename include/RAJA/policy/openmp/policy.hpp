@@ -255,6 +255,17 @@ struct omp_work : make_policy_pattern_launch_platform_t<Policy::openmp,
                                                         Platform::host> {
 };
 
+///
+///  WorkGroup order policy that runs all of the loops in one parallel region
+///  by giving each thread an equal contiguous piece of the iteration space
+///  formed by concatenating the loops.
+///
+struct unordered_omp_flattened_static
+    : make_policy_pattern_platform_t<Policy::openmp,
+                                     Pattern::workgroup_order,
+                                     Platform::host> {
+};
+
 ///
 ///////////////////////////////////////////////////////////////////////
 ///
@@ -270,6 +281,21 @@ struct omp_reduce_ordered
     : make_policy_pattern_t<Policy::openmp, Pattern::reduce, reduce::ordered> {
 };
 
+///
+///  Reduction with cache-line padded per-thread partial results that are
+///  combined without a critical section.
+///
+struct omp_reduce_padded : make_policy_pattern_t<Policy::openmp, Pattern::reduce> {
+};
+
+///
+///  Reduction whose floating point sums are the same for any number of
+///  threads and any loop schedule.
+///
+struct omp_reduce_reproducible
+    : make_policy_pattern_t<Policy::openmp, Pattern::reduce> {
+};
+
 ///
 struct omp_synchronize : make_policy_pattern_launch_t<Policy::openmp,
                                                       Pattern::synchronize,
@@ -359,6 +385,10 @@ using policy::omp::omp_parallel_region;
 using policy::omp::omp_reduce;
 ///
 using policy::omp::omp_reduce_ordered;
+///
+using policy::omp::omp_reduce_padded;
+///
+using policy::omp::omp_reduce_reproducible;
 
 ///
 /// Type aliases for omp reductions
@@ -368,6 +398,9 @@ using policy::omp::omp_synchronize;
 ///
 using policy::omp::omp_work;
 
+///
+using policy::omp::unordered_omp_flattened_static;
+
 }  // namespace RAJA
 
 #endif
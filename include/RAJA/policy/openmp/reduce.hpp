@@ -25,13 +25,16 @@
 
 #if defined(RAJA_ENABLE_OPENMP)
 
-#include <memory>
-#include <vector>
+#include <new>
 
 #include <omp.h>
 
+#include "RAJA/util/basic_mempool.hpp"
+#include "RAJA/util/mutex.hpp"
 #include "RAJA/util/types.hpp"
 
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
 #include "RAJA/pattern/detail/reduce.hpp"
 #include "RAJA/pattern/reduce.hpp"
 
@@ -67,21 +70,268 @@ public:
 
 RAJA_DECLARE_ALL_REDUCERS(omp_reduce, detail::ReduceOMP)
 
+RAJA_DECLARE_REPRODUCIBLE_REDUCERS(omp_reduce_reproducible, detail::ReduceOMP)
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Reductions using one cache-line padded slot per thread.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+namespace detail
+{
+
+//! reducer value padded out to its own cache line
+template <typename T>
+struct alignas(RAJA::DATA_ALIGN) OMPReduceSlot {
+  T value;
+};
+
+//! host allocator returning cache-line aligned memory for reducer slots
+struct OMPReduceSlotAllocator {
+
+  // returns a valid pointer on success, nullptr on failure
+  void* malloc(size_t nbytes)
+  {
+    return RAJA::allocate_aligned(RAJA::DATA_ALIGN, nbytes);
+  }
+
+  // returns true on success, false on failure
+  bool free(void* ptr)
+  {
+    RAJA::free_aligned(ptr);
+    return true;
+  }
+};
+
+using omp_reduce_slot_mempool_type =
+    basic_mempool::MemPool<OMPReduceSlotAllocator>;
+
+//! persistent pool that reducer slot arrays are drawn from and returned to
+inline omp_reduce_slot_mempool_type& get_omp_reduce_slot_mempool()
+{
+  static omp_reduce_slot_mempool_type& pool = []() -> omp_reduce_slot_mempool_type& {
+    omp_reduce_slot_mempool_type& instance =
+        omp_reduce_slot_mempool_type::getInstance();
+    // slot arrays are small, do not reserve the default arena size
+    instance.arena_size(1024ull * 1024ull);
+    return instance;
+  }();
+  return pool;
+}
+
+/*!
+ * \brief  Array of per-thread reducer slots, one cache line per thread.
+ *
+ *         Storage is drawn from a persistent pool on the first reset and
+ *         reused by later resets unless the maximum number of OpenMP threads
+ *         has grown, so constructing reducers for each kernel does not
+ *         allocate from the heap once the pool is warm.
+ */
+template <typename T>
+class OMPReduceSlots
+{
+  using slot_type = OMPReduceSlot<T>;
+
+public:
+  OMPReduceSlots() : m_slots(nullptr), m_size(0) {}
+
+  OMPReduceSlots(OMPReduceSlots const&) = delete;
+  OMPReduceSlots& operator=(OMPReduceSlots const&) = delete;
+
+  ~OMPReduceSlots() { release(); }
+
+  //! (re)initialize every slot to identity_
+  void reset(T const& identity_)
+  {
+    int num_threads = omp_get_max_threads();
+    if (num_threads > m_size) {
+      release();
+      m_slots = get_omp_reduce_slot_mempool().template malloc<slot_type>(
+          num_threads);
+      if (!m_slots) {
+        throw std::bad_alloc();
+      }
+      for (int i = 0; i < num_threads; ++i) {
+        new (&m_slots[i]) slot_type{identity_};
+        m_size = i + 1;
+      }
+    } else {
+      for (int i = 0; i < m_size; ++i) {
+        m_slots[i].value = identity_;
+      }
+    }
+    m_overflow = identity_;
+  }
+
+  int size() const { return m_size; }
+
+  /*!
+   * \brief  Fold val into the calling thread's slot.
+   *
+   *         Threads without a slot of their own, which only happens in nested
+   *         parallel regions or when the thread count was raised after the
+   *         last reset, fall back to a lock owned by this object. Nested
+   *         regions are detected with omp_get_level, which also counts
+   *         inactive regions whose threads all have thread number 0.
+   */
+  template <typename Reduce>
+  void combine(T const& val, Reduce const& reduce)
+  {
+    int tid = omp_get_thread_num();
+    if (tid < size() && omp_get_level() <= 1) {
+      reduce(m_slots[tid].value, val);
+    } else {
+      lock_guard<omp::mutex> lock(m_overflow_mutex);
+      reduce(m_overflow, val);
+    }
+  }
+
+  /*!
+   * \brief  Fold all slots into val with a pairwise tree and set the slots
+   *         back to identity_.
+   *
+   *         The shape of the tree only depends on the number of slots, so
+   *         the result does not depend on the order in which threads
+   *         finished.
+   */
+  template <typename Reduce>
+  void finalize(T& val, T const& identity_, Reduce const& reduce)
+  {
+    slot_type* slots = m_slots;
+    const int num_slots = size();
+    for (int stride = 1; stride < num_slots; stride *= 2) {
+      for (int i = 0; i + stride < num_slots; i += 2 * stride) {
+        reduce(slots[i].value, slots[i + stride].value);
+        slots[i + stride].value = identity_;
+      }
+    }
+    if (num_slots > 0) {
+      reduce(val, slots[0].value);
+      slots[0].value = identity_;
+    }
+    reduce(val, m_overflow);
+    m_overflow = identity_;
+  }
+
+private:
+  //! destroy the slots and give their storage back to the pool
+  void release()
+  {
+    if (m_slots) {
+      for (int i = 0; i < m_size; ++i) {
+        m_slots[i].~slot_type();
+      }
+      get_omp_reduce_slot_mempool().free(m_slots);
+      m_slots = nullptr;
+      m_size = 0;
+    }
+  }
+
+  slot_type* m_slots;
+  int m_size;
+  T m_overflow;
+  omp::mutex m_overflow_mutex;
+};
+
+/*!
+ * \brief  OpenMP reducer combiner that never serializes on a shared lock.
+ *
+ *         Each copy of the reducer folds its partial result into a padded
+ *         per-thread slot owned by the original object when it is destroyed.
+ *         The slots are combined once, when the value is requested.
+ */
+template <typename T, typename Reduce>
+class ReduceOMPPadded
+    : public reduce::detail::
+          BaseCombinable<T, Reduce, ReduceOMPPadded<T, Reduce>>
+{
+  using Base = reduce::detail::BaseCombinable<T, Reduce, ReduceOMPPadded>;
+  //! only used by the original object, copies leave it empty
+  mutable OMPReduceSlots<T> slots;
+
+  const ReduceOMPPadded& root() const
+  {
+    return Base::parent ? *static_cast<const ReduceOMPPadded*>(Base::parent)
+                        : *this;
+  }
+
+public:
+  //! prohibit compiler-generated default ctor
+  ReduceOMPPadded() = delete;
+
+  //! constructor requires a default value for the reducer
+  ReduceOMPPadded(T init_val, T identity_)
+      : Base(init_val, identity_)
+  {
+    slots.reset(identity_);
+  }
+
+  //! copies share the slots of the original reducer
+  ReduceOMPPadded(const ReduceOMPPadded& other) : Base(other) {}
+
+  void reset(T init_val, T identity_)
+  {
+    Base::reset(init_val, identity_);
+    if (!Base::parent) {
+      slots.reset(identity_);
+    }
+  }
+
+  ~ReduceOMPPadded()
+  {
+    if (Base::parent) {
+      if (Base::my_data != Base::identity) {
+        root().slots.combine(Base::my_data, Reduce{});
+      }
+      Base::my_data = Base::identity;
+    }
+  }
+
+  T get_combined() const
+  {
+    const ReduceOMPPadded& r = root();
+    r.slots.finalize(r.my_data, r.identity, Reduce{});
+    return r.my_data;
+  }
+};
+
+}  // namespace detail
+
+RAJA_DECLARE_ALL_REDUCERS(omp_reduce_padded, detail::ReduceOMPPadded)
+
 ///////////////////////////////////////////////////////////////////////////////
 //
-// Old ordered reductions are included below.
+// Ordered reductions are included below.
 //
 ///////////////////////////////////////////////////////////////////////////////
 
 namespace detail
 {
+
+/*!
+ * \brief  OpenMP reducer combiner with a deterministic result.
+ *
+ *         Each thread folds its partial results into its own padded slot
+ *         from the persistent slot pool, and the slots are combined with a
+ *         fixed-shape pairwise tree in thread order, so for a given number
+ *         of threads and loop schedule the result is reproducible bitwise
+ *         from run to run.
+ */
 template <typename T, typename Reduce>
 class ReduceOMPOrdered
     : public reduce::detail::
           BaseCombinable<T, Reduce, ReduceOMPOrdered<T, Reduce>>
 {
   using Base = reduce::detail::BaseCombinable<T, Reduce, ReduceOMPOrdered>;
-  std::shared_ptr<std::vector<T>> data;
+  //! only used by the original object, copies leave it empty
+  mutable OMPReduceSlots<T> slots;
+
+  const ReduceOMPOrdered& root() const
+  {
+    return Base::parent ? *static_cast<const ReduceOMPOrdered*>(Base::parent)
+                        : *this;
+  }
 
 public:
   ReduceOMPOrdered() { reset(T(), T()); }
@@ -92,31 +342,30 @@ public:
     reset(init_val, identity_);
   }
 
+  //! copies share the slots of the original reducer
+  ReduceOMPOrdered(const ReduceOMPOrdered& other) : Base(other) {}
+
   void reset(T init_val, T identity_)
   {
     Base::reset(init_val, identity_);
-    data = std::shared_ptr<std::vector<T>>(
-        std::make_shared<std::vector<T>>(omp_get_max_threads(), identity_));
+    if (!Base::parent) {
+      slots.reset(identity_);
+    }
   }
 
   ~ReduceOMPOrdered()
   {
-    Reduce{}((*data)[omp_get_thread_num()], Base::my_data);
-    Base::my_data = Base::identity;
+    if (Base::parent) {
+      root().slots.combine(Base::my_data, Reduce{});
+      Base::my_data = Base::identity;
+    }
   }
 
   T get_combined() const
   {
-    if (Base::my_data != Base::identity) {
-      Reduce{}((*data)[omp_get_thread_num()], Base::my_data);
-      Base::my_data = Base::identity;
-    }
-
-    T res = Base::identity;
-    for (size_t i = 0; i < data->size(); ++i) {
-      Reduce{}(res, (*data)[i]);
-    }
-    return res;
+    const ReduceOMPOrdered& r = root();
+    r.slots.finalize(r.my_data, r.identity, Reduce{});
+    return r.my_data;
   }
 };
 
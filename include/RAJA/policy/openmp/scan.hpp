@@ -21,16 +21,20 @@
 #include "RAJA/config.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <iterator>
+#include <memory>
+#include <new>
+#include <thread>
 #include <type_traits>
-#include <vector>
 
 #include <omp.h>
 
 #include "RAJA/policy/openmp/policy.hpp"
 #include "RAJA/policy/loop/scan.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
+#include "RAJA/internal/MemUtils_CPU.hpp"
 
 namespace RAJA
 {
@@ -39,6 +43,179 @@ namespace impl
 namespace scan
 {
 
+namespace detail
+{
+
+//! bytes of output each chunk of the single-pass scan covers
+constexpr size_t omp_scan_chunk_bytes = 64 * 1024;
+
+//! states a chunk of the single-pass scan moves through
+enum class ScanChunkState : int { invalid = 0, aggregate = 1, prefix = 2 };
+
+/*!
+ * \brief  Status a chunk publishes to the chunks after it.
+ *
+ *         Once state is aggregate, aggregate holds the reduction of the
+ *         chunk's inputs. Once state is prefix, inclusive_prefix holds the
+ *         reduction of all inputs up to and including the chunk.
+ */
+template <typename Value>
+struct alignas(RAJA::DATA_ALIGN) ScanChunkStatus {
+  std::atomic<int> state;
+  Value aggregate;
+  Value inclusive_prefix;
+};
+
+/*!
+ * \brief  Scan one chunk of [in, in + len) into out starting from init and
+ *         return the reduction of init and the chunk's inputs.
+ */
+template <bool Exclusive, typename Iter, typename OutIter, typename BinFn,
+          typename Value>
+RAJA_INLINE Value scan_chunk(Iter in, OutIter out, size_t len, BinFn f,
+                             Value init)
+{
+  Value agg = init;
+  if (Exclusive) {
+    for (size_t i = 0; i < len; ++i) {
+      Value t = in[i];
+      out[i] = agg;
+      agg = f(agg, t);
+    }
+  } else {
+    for (size_t i = 0; i < len; ++i) {
+      agg = f(agg, in[i]);
+      out[i] = agg;
+    }
+  }
+  return agg;
+}
+
+/*!
+ * \brief  Wait for chunk id - 1 and its predecessors to publish and return
+ *         the reduction of every input before chunk id.
+ */
+template <typename Value, typename BinFn>
+RAJA_INLINE Value scan_look_back(ScanChunkStatus<Value>* status,
+                                 size_t id,
+                                 BinFn f)
+{
+  Value exclusive_agg = BinFn::identity();
+  size_t j = id;
+  while (j > 0) {
+    --j;
+    int state;
+    int spins = 0;
+    while ((state = status[j].state.load(std::memory_order_acquire)) ==
+           static_cast<int>(ScanChunkState::invalid)) {
+      if (++spins > 1024) {
+        std::this_thread::yield();
+      }
+    }
+    if (state == static_cast<int>(ScanChunkState::prefix)) {
+      return f(status[j].inclusive_prefix, exclusive_agg);
+    }
+    exclusive_agg = f(status[j].aggregate, exclusive_agg);
+  }
+  return exclusive_agg;
+}
+
+/*!
+ * \brief  Single-pass OpenMP scan using decoupled look-back.
+ *
+ *         Threads claim fixed size chunks in order. A chunk whose predecessor
+ *         has already published its inclusive prefix is scanned directly
+ *         from that prefix. Otherwise the chunk is scanned locally, publishes
+ *         its aggregate, looks back over its predecessors' status until it
+ *         finds an inclusive prefix, publishes its own inclusive prefix and
+ *         applies the prefix to the chunk while it is still in cache. Each
+ *         input is read once and each output written once from memory, with
+ *         no barrier between threads.
+ *
+ *         in and out may refer to the same range.
+ */
+template <bool Exclusive, typename Iter, typename OutIter, typename BinFn,
+          typename ValueT>
+void single_pass_scan(Iter begin, Iter end, OutIter out, BinFn f, ValueT init)
+{
+  using Value = RAJA::detail::IterVal<OutIter>;
+  using Status = ScanChunkStatus<Value>;
+  using std::distance;
+
+  const auto n_dist = distance(begin, end);
+  if (n_dist <= 0) {
+    return;
+  }
+  const size_t n = static_cast<size_t>(n_dist);
+  const size_t max_threads = static_cast<size_t>(omp_get_max_threads());
+
+  const size_t max_chunk =
+      std::max(omp_scan_chunk_bytes / sizeof(Value), static_cast<size_t>(1));
+  const size_t chunk =
+      std::min(max_chunk, (n + max_threads - 1) / max_threads);
+  const size_t num_chunks = (n + chunk - 1) / chunk;
+  const int num_threads = static_cast<int>(std::min(num_chunks, max_threads));
+
+  std::unique_ptr<Status, RAJA::FreeAlignedType<Status, size_t>> status(
+      RAJA::allocate_aligned_type<Status>(RAJA::DATA_ALIGN,
+                                          num_chunks * sizeof(Status)));
+  if (!status) {
+    throw std::bad_alloc();
+  }
+  for (size_t i = 0; i < num_chunks; ++i) {
+    Status* s = new (&status.get()[i]) Status;
+    s->state.store(static_cast<int>(ScanChunkState::invalid),
+                   std::memory_order_relaxed);
+    status.get_deleter().size = i + 1;
+  }
+
+  std::atomic<size_t> next_chunk{0};
+  const Value first_prefix = Exclusive ? Value(init) : Value(BinFn::identity());
+
+#pragma omp parallel num_threads(num_threads)
+  {
+    Status* const st = status.get();
+    for (size_t id = next_chunk.fetch_add(1, std::memory_order_relaxed);
+         id < num_chunks;
+         id = next_chunk.fetch_add(1, std::memory_order_relaxed)) {
+
+      const size_t idx_begin = id * chunk;
+      const size_t len = std::min(chunk, n - idx_begin);
+      Iter in = begin + idx_begin;
+      OutIter o = out + idx_begin;
+
+      if (id == 0 || st[id - 1].state.load(std::memory_order_acquire) ==
+                         static_cast<int>(ScanChunkState::prefix)) {
+
+        // prefix already known, scan the chunk once
+        const Value prefix =
+            (id == 0) ? first_prefix : st[id - 1].inclusive_prefix;
+        st[id].inclusive_prefix = scan_chunk<Exclusive>(in, o, len, f, prefix);
+        st[id].state.store(static_cast<int>(ScanChunkState::prefix),
+                           std::memory_order_release);
+
+      } else {
+
+        st[id].aggregate =
+            scan_chunk<Exclusive>(in, o, len, f, Value(BinFn::identity()));
+        st[id].state.store(static_cast<int>(ScanChunkState::aggregate),
+                           std::memory_order_release);
+
+        const Value prefix = scan_look_back(st, id, f);
+        st[id].inclusive_prefix = f(prefix, st[id].aggregate);
+        st[id].state.store(static_cast<int>(ScanChunkState::prefix),
+                           std::memory_order_release);
+
+        for (size_t i = 0; i < len; ++i) {
+          o[i] = f(prefix, o[i]);
+        }
+      }
+    }
+  }
+}
+
+}  // namespace detail
+
 /*!
         \brief explicit inclusive inplace scan given range, function, and
    initial value
@@ -54,32 +231,7 @@ inclusive_inplace(
     Iter end,
     BinFn f)
 {
-  using std::distance;
-  using RAJA::detail::firstIndex;
-  using Value = typename ::std::iterator_traits<Iter>::value_type;
-  const auto n = distance(begin, end);
-  using DistanceT = typename std::remove_const<decltype(n)>::type;
-  const int p0 = std::min(n, static_cast<DistanceT>(omp_get_max_threads()));
-  ::std::vector<Value> sums(p0, Value());
-#pragma omp parallel num_threads(p0)
-  {
-    const int p = omp_get_num_threads();
-    const int pid = omp_get_thread_num();
-    const DistanceT idx_begin = firstIndex(n, p, pid);
-    const DistanceT idx_end = firstIndex(n, p, pid + 1);
-    if (idx_begin != idx_end) {
-      inclusive_inplace(host_res, ::RAJA::loop_exec{},
-                        begin + idx_begin, begin + idx_end, f);
-      sums[pid] = begin[idx_end - 1];
-    }
-#pragma omp barrier
-#pragma omp single
-    exclusive_inplace(host_res, ::RAJA::loop_exec{},
-                      sums.data(), sums.data() + p, f, BinFn::identity());
-    for (auto i = idx_begin; i < idx_end; ++i) {
-      begin[i] = f(begin[i], sums[pid]);
-    }
-  }
+  detail::single_pass_scan<false>(begin, end, begin, f, BinFn::identity());
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -100,34 +252,7 @@ exclusive_inplace(
     BinFn f,
     ValueT v)
 {
-  using std::distance;
-  using RAJA::detail::firstIndex;
-  using Value = typename ::std::iterator_traits<Iter>::value_type;
-  const auto n = distance(begin, end);
-  using DistanceT = typename std::remove_const<decltype(n)>::type;
-  const int p0 = std::min(n, static_cast<DistanceT>(omp_get_max_threads()));
-  ::std::vector<Value> sums(p0, v);
-#pragma omp parallel num_threads(p0)
-  {
-    const int p = omp_get_num_threads();
-    const int pid = omp_get_thread_num();
-    const DistanceT idx_begin = firstIndex(n, p, pid);
-    const DistanceT idx_end = firstIndex(n, p, pid + 1);
-    const Value init = ((pid == 0) ? v : *(begin + idx_begin - 1));
-#pragma omp barrier
-    if (idx_begin != idx_end) {
-      exclusive_inplace(host_res, loop_exec{},
-                        begin + idx_begin, begin + idx_end, f, init);
-      sums[pid] = begin[idx_end - 1];
-    }
-#pragma omp barrier
-#pragma omp single
-    exclusive_inplace(host_res, loop_exec{},
-                      sums.data(), sums.data() + p, f, BinFn::identity());
-    for (auto i = idx_begin; i < idx_end; ++i) {
-      begin[i] = f(begin[i], sums[pid]);
-    }
-  }
+  detail::single_pass_scan<true>(begin, end, begin, f, v);
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -142,15 +267,15 @@ concepts::enable_if_t<resources::EventProxy<resources::Host>,
                       type_traits::is_openmp_policy<Policy>>
 inclusive(
     resources::Host host_res,
-    const Policy& exec,
+    const Policy&,
     Iter begin,
     Iter end,
     OutIter out,
     BinFn f)
 {
-  using std::distance;
-  ::std::copy(begin, end, out);
-  return inclusive_inplace(host_res, exec, out, out + distance(begin, end), f);
+  detail::single_pass_scan<false>(begin, end, out, f, BinFn::identity());
+
+  return resources::EventProxy<resources::Host>(host_res);
 }
 
 /*!
@@ -167,16 +292,16 @@ concepts::enable_if_t<resources::EventProxy<resources::Host>,
                       type_traits::is_openmp_policy<Policy>>
 exclusive(
     resources::Host host_res,
-    const Policy& exec,
+    const Policy&,
     Iter begin,
     Iter end,
     OutIter out,
     BinFn f,
     ValueT v)
 {
-  using std::distance;
-  ::std::copy(begin, end, out);
-  return exclusive_inplace(host_res, exec, out, out + distance(begin, end), f, v);
+  detail::single_pass_scan<true>(begin, end, out, f, v);
+
+  return resources::EventProxy<resources::Host>(host_res);
 }
 
 }  // namespace scan
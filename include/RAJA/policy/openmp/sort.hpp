@@ -23,6 +23,9 @@
 #include <algorithm>
 #include <functional>
 #include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
 
 #include <omp.h>
 
@@ -34,6 +37,8 @@
 #include "RAJA/policy/loop/sort.hpp"
 #include "RAJA/pattern/detail/algorithm.hpp"
 
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
 namespace RAJA
 {
 namespace impl
@@ -49,41 +54,229 @@ namespace openmp
 // this number is arbitrary
 constexpr int get_min_iterates_per_task() { return 128; }
 
+/*!
+        \brief find the number of items taken from the first of two sorted
+               ranges a and b in the first k items of their stable merge
+*/
+template <typename Iter, typename Compare>
+inline RAJA::detail::IterDiff<Iter> merge_corank(
+    RAJA::detail::IterDiff<Iter> k,
+    Iter a,
+    RAJA::detail::IterDiff<Iter> a_len,
+    Iter b,
+    RAJA::detail::IterDiff<Iter> b_len,
+    Compare comp)
+{
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+
+  diff_type lo = (k > b_len) ? k - b_len : 0;
+  diff_type hi = (k < a_len) ? k : a_len;
+
+  // find the smallest i such that a[i] is not in the first k items
+  while (lo < hi) {
+    const diff_type i = lo + (hi - lo) / 2;
+    if (comp(b[k - i - 1], a[i])) {
+      hi = i;
+    } else {
+      lo = i + 1;
+    }
+  }
+  return lo;
+}
+
+/*!
+        \brief move construct val into uninitialized storage at out
+*/
+template <typename OutIter, typename T>
+RAJA_INLINE void merge_store(std::true_type, OutIter out, T&& val)
+{
+  new (&*out) RAJA::detail::IterVal<OutIter>(std::forward<T>(val));
+}
+
+/*!
+        \brief move assign val to out
+*/
+template <typename OutIter, typename T>
+RAJA_INLINE void merge_store(std::false_type, OutIter out, T&& val)
+{
+  *out = std::forward<T>(val);
+}
+
+/*!
+        \brief write items [k_begin, k_end) of the stable merge of sorted
+               ranges a and b to out
+*/
+template <bool Construct, typename Iter, typename OutIter, typename Compare>
+inline void merge_slice(Iter a,
+                        RAJA::detail::IterDiff<Iter> a_len,
+                        Iter b,
+                        RAJA::detail::IterDiff<Iter> b_len,
+                        RAJA::detail::IterDiff<Iter> k_begin,
+                        RAJA::detail::IterDiff<Iter> k_end,
+                        OutIter out,
+                        Compare comp)
+{
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+
+  diff_type i = merge_corank(k_begin, a, a_len, b, b_len, comp);
+  diff_type j = k_begin - i;
+  const diff_type i_end = merge_corank(k_end, a, a_len, b, b_len, comp);
+  const diff_type j_end = k_end - i_end;
+
+  for (diff_type k = k_begin; k < k_end; ++k) {
+    if (j >= j_end || (i < i_end && !comp(b[j], a[i]))) {
+      merge_store(std::integral_constant<bool, Construct>{}, out + k, std::move(a[i]));
+      ++i;
+    } else {
+      merge_store(std::integral_constant<bool, Construct>{}, out + k, std::move(b[j]));
+      ++j;
+    }
+  }
+}
+
+/*!
+        \brief write items [k_begin, k_end) of one level of a bottom up merge
+               of num_blocks sorted blocks in src to dst
+
+        Blocks are [firstIndex(n, num_blocks, i), firstIndex(n, num_blocks, i+1))
+        and this level merges runs of width blocks pairwise. Every item of dst
+        is written by exactly one call, so the items of a level can be split
+        evenly between threads regardless of how the runs are laid out.
+*/
+template <bool Construct, typename Iter, typename OutIter, typename Compare>
+inline void merge_level_slice(Iter src,
+                              OutIter dst,
+                              RAJA::detail::IterDiff<Iter> n,
+                              RAJA::detail::IterDiff<Iter> num_blocks,
+                              RAJA::detail::IterDiff<Iter> width,
+                              RAJA::detail::IterDiff<Iter> k_begin,
+                              RAJA::detail::IterDiff<Iter> k_end,
+                              Compare comp)
+{
+  using RAJA::detail::firstIndex;
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+
+  if (k_begin >= k_end) {
+    return;
+  }
+
+  auto block_begin = [&](diff_type blk) {
+    return firstIndex(n, num_blocks, std::min(blk, num_blocks));
+  };
+
+  // find the block containing k_begin
+  diff_type blk = static_cast<diff_type>(
+      (static_cast<size_t>(k_begin) * num_blocks) / n);
+  while (blk > 0 && block_begin(blk) > k_begin) {
+    --blk;
+  }
+  while (block_begin(blk + 1) <= k_begin) {
+    ++blk;
+  }
+
+  for (diff_type run = blk - blk % (2 * width);
+       run < num_blocks && block_begin(run) < k_end;
+       run += 2 * width) {
+
+    const diff_type i_begin = block_begin(run);
+    const diff_type i_middle = block_begin(run + width);
+    const diff_type i_end = block_begin(run + 2 * width);
+
+    merge_slice<Construct>(src + i_begin, i_middle - i_begin,
+                           src + i_middle, i_end - i_middle,
+                           std::max(k_begin, i_begin) - i_begin,
+                           std::min(k_end, i_end) - i_begin,
+                           dst + i_begin, comp);
+  }
+}
+
+/*!
+        \brief merge num_blocks sorted blocks of [begin, begin + n) level by
+               level, splitting the items of each level evenly between
+               num_slices slices, and leave the result in begin
+
+        merge_slices(level_fn) must call level_fn(slice) for every slice in
+        [0, num_slices) and wait for all of them to finish before returning.
+        Levels alternate between begin and scratch; the first level move
+        constructs into the uninitialized scratch storage.
+*/
+template <typename Iter, typename Compare, typename MergeSlices>
+inline void merge_blocks(Iter begin,
+                         RAJA::detail::IterVal<Iter>* scratch,
+                         RAJA::detail::IterDiff<Iter> n,
+                         RAJA::detail::IterDiff<Iter> num_blocks,
+                         RAJA::detail::IterDiff<Iter> num_slices,
+                         Compare comp,
+                         MergeSlices&& merge_slices)
+{
+  using RAJA::detail::firstIndex;
+  using diff_type = RAJA::detail::IterDiff<Iter>;
+
+  bool in_scratch = false;
+  for (diff_type width = 1; width < num_blocks; width *= 2) {
+
+    const bool construct = (width == 1);
+    merge_slices([&](diff_type slice) {
+      const diff_type k_begin = firstIndex(n, num_slices, slice);
+      const diff_type k_end   = firstIndex(n, num_slices, slice + 1);
+      if (construct) {
+        merge_level_slice<true>(begin, scratch, n, num_blocks, width,
+                                k_begin, k_end, comp);
+      } else if (in_scratch) {
+        merge_level_slice<false>(scratch, begin, n, num_blocks, width,
+                                 k_begin, k_end, comp);
+      } else {
+        merge_level_slice<false>(begin, scratch, n, num_blocks, width,
+                                 k_begin, k_end, comp);
+      }
+    });
+
+    in_scratch = !in_scratch;
+  }
+
+  if (in_scratch) {
+    merge_slices([&](diff_type slice) {
+      const diff_type k_begin = firstIndex(n, num_slices, slice);
+      const diff_type k_end   = firstIndex(n, num_slices, slice + 1);
+      std::move(scratch + k_begin, scratch + k_end, begin + k_begin);
+    });
+  }
+}
+
 #ifdef RAJA_ENABLE_OPENMP_TASK
 /*!
         \brief sort given range using sorter and comparison function
-               by spawning tasks
+               by spawning tasks to sort blocks and to merge each level
 */
 template <typename Sorter, typename Iter, typename Compare>
 inline void sort_task(Sorter sorter,
                       Iter begin,
-                      RAJA::detail::IterDiff<Iter> i_begin,
-                      RAJA::detail::IterDiff<Iter> i_end,
+                      RAJA::detail::IterVal<Iter>* scratch,
+                      RAJA::detail::IterDiff<Iter> n,
                       RAJA::detail::IterDiff<Iter> iterates_per_task,
                       Compare comp)
 {
+  using RAJA::detail::firstIndex;
   using diff_type = RAJA::detail::IterDiff<Iter>;
-  const diff_type n = i_end - i_begin;
-
-  if (n <= iterates_per_task) {
-
-    sorter(begin+i_begin, begin+i_end, comp);
-
-  } else {
-
-    const diff_type i_middle = i_begin + n/2;
 
-#pragma omp task
-    sort_task(sorter, begin, i_begin, i_middle, iterates_per_task, comp);
-
-#pragma omp task
-    sort_task(sorter, begin, i_middle, i_end, iterates_per_task, comp);
+  const diff_type num_blocks = (n + iterates_per_task - 1) / iterates_per_task;
 
+  for (diff_type blk = 0; blk < num_blocks; ++blk) {
+#pragma omp task firstprivate(blk)
+    sorter(begin + firstIndex(n, num_blocks, blk),
+           begin + firstIndex(n, num_blocks, blk + 1),
+           comp);
+  }
 #pragma omp taskwait
 
-    //std::inplace_merge(begin + i_begin, begin + i_middle, begin + i_end, comp);
-    RAJA::detail::inplace_merge(begin + i_begin, begin + i_middle, begin + i_end, comp);
-  }
+  merge_blocks(begin, scratch, n, num_blocks, num_blocks, comp,
+               [&](auto&& level_fn) {
+    for (diff_type slice = 0; slice < num_blocks; ++slice) {
+#pragma omp task firstprivate(slice)
+      level_fn(slice);
+    }
+#pragma omp taskwait
+  });
 }
 
 #else
@@ -95,6 +288,7 @@ inline void sort_task(Sorter sorter,
 template <typename Sorter, typename Iter, typename Compare>
 inline void sort_parallel_region(Sorter sorter,
                                  Iter begin,
+                                 RAJA::detail::IterVal<Iter>* scratch,
                                  RAJA::detail::IterDiff<Iter> n,
                                  Compare comp)
 {
@@ -105,31 +299,21 @@ inline void sort_parallel_region(Sorter sorter,
 
   const diff_type thread_id = omp_get_thread_num();
 
-  const diff_type i_begin = firstIndex(n, num_threads, thread_id);
   {
-    const diff_type i_end = firstIndex(n, num_threads, thread_id + 1);
+    const diff_type i_begin = firstIndex(n, num_threads, thread_id);
+    const diff_type i_end   = firstIndex(n, num_threads, thread_id + 1);
 
     // this thread sorts range [i_begin, i_end)
     sorter(begin + i_begin, begin + i_end, comp);
   }
 
-  // hierarchically merge ranges
-  for (diff_type middle_offset = 1; middle_offset < num_threads; middle_offset *= 2) {
-
-    diff_type end_offset = 2*middle_offset;
-
-    const diff_type i_middle = firstIndex(n, num_threads, std::min(thread_id + middle_offset, num_threads));
-    const diff_type i_end    = firstIndex(n, num_threads, std::min(thread_id + end_offset,    num_threads));
-
+  // hierarchically merge ranges, every thread takes an equal share of
+  // every level
+  merge_blocks(begin, scratch, n, num_threads, num_threads, comp,
+               [&](auto&& level_fn) {
 #pragma omp barrier
-
-    if (thread_id % end_offset == 0) {
-
-      // this thread merges ranges [i_begin, i_middle) and [i_middle, i_end)
-      //std::inplace_merge(begin + i_begin, begin + i_middle, begin + i_end, comp);
-      RAJA::detail::inplace_merge(begin + i_begin, begin + i_middle, begin + i_end, comp);
-    }
-  }
+    level_fn(thread_id);
+  });
 }
 
 #endif
@@ -146,6 +330,7 @@ void sort(Sorter sorter,
           Compare comp)
 {
   using diff_type = RAJA::detail::IterDiff<Iter>;
+  using value_type = RAJA::detail::IterVal<Iter>;
 
   constexpr diff_type min_iterates_per_task = get_min_iterates_per_task();
 
@@ -159,31 +344,81 @@ void sort(Sorter sorter,
 
     const diff_type max_threads = omp_get_max_threads();
 
+    // scratch storage shared by every merge level, objects are constructed
+    // in the first merge level
+    using buf_deleter_type = FreeAlignedType<value_type, diff_type>;
+    buf_deleter_type buf_deleter;
+
+    std::unique_ptr<value_type, buf_deleter_type&> scratch_buf(
+        RAJA::allocate_aligned_type<value_type>( RAJA::DATA_ALIGN, n * sizeof(value_type) ),
+        buf_deleter);
+
+    value_type* scratch = scratch_buf.get();
+
+    // check memory allocation worked
+    if (scratch == nullptr) {
+      RAJA_ABORT_OR_THROW( "openmp sort temporary memory allocation failed" );
+    }
+
 #ifdef RAJA_ENABLE_OPENMP_TASK
 
     const diff_type iterates_per_task = std::max(n/(2*max_threads), min_iterates_per_task);
 
     const diff_type requested_num_threads = std::min((n+iterates_per_task-1)/iterates_per_task, max_threads);
 
+    const diff_type num_blocks = (n+iterates_per_task-1)/iterates_per_task;
+
 #pragma omp parallel num_threads(static_cast<int>(requested_num_threads))
 #pragma omp master
     {
-      sort_task(sorter, begin, 0, n, iterates_per_task, comp);
+      sort_task(sorter, begin, scratch, n, iterates_per_task, comp);
     }
 
 #else
 
     const diff_type requested_num_threads = std::min((n+min_iterates_per_task-1)/min_iterates_per_task, max_threads);
 
+    diff_type num_blocks = 1;
+
 #pragma omp parallel num_threads(static_cast<int>(requested_num_threads))
     {
-      sort_parallel_region(sorter, begin, n, comp);
+#pragma omp single nowait
+      num_blocks = omp_get_num_threads();
+
+      sort_parallel_region(sorter, begin, scratch, n, comp);
     }
 
 #endif
+
+    // the first merge level constructed every object in scratch
+    if (num_blocks > 1) {
+      buf_deleter.size = n;
+    }
   }
 }
 
+/*!
+        \brief runs the parts of a radix sort pass in an omp parallel for
+*/
+struct RadixParts
+{
+  size_t num_parts(size_t n) const
+  {
+    const size_t max_parts = n / RAJA::detail::radix_sort_min_items_per_part();
+    return std::max(std::min(static_cast<size_t>(omp_get_max_threads()), max_parts),
+                    static_cast<size_t>(1));
+  }
+
+  template <typename Func>
+  void operator()(size_t num, Func&& func) const
+  {
+#pragma omp parallel for schedule(static)
+    for (size_t part = 0; part < num; ++part) {
+      func(part);
+    }
+  }
+};
+
 } // namespace openmp
 
 } // namespace detail
@@ -201,7 +436,9 @@ unstable(
     Iter end,
     Compare comp)
 {
-  detail::openmp::sort(detail::UnstableSorter{}, begin, end, comp);
+  if (!RAJA::detail::try_radix_sort(detail::openmp::RadixParts{}, begin, end, comp)) {
+    detail::openmp::sort(detail::UnstableSorter{}, begin, end, comp);
+  }
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -219,7 +456,9 @@ stable(
     Iter end,
     Compare comp)
 {
-  detail::openmp::sort(detail::StableSorter{}, begin, end, comp);
+  if (!RAJA::detail::try_radix_sort(detail::openmp::RadixParts{}, begin, end, comp)) {
+    detail::openmp::sort(detail::StableSorter{}, begin, end, comp);
+  }
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -238,10 +477,12 @@ unstable_pairs(
     ValIter vals_begin,
     Compare comp)
 {
-  auto begin  = RAJA::zip(keys_begin, vals_begin);
-  auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
-  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
-  detail::openmp::sort(detail::UnstableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
+  if (!RAJA::detail::try_radix_sort_pairs(detail::openmp::RadixParts{}, keys_begin, keys_end, vals_begin, comp)) {
+    auto begin  = RAJA::zip(keys_begin, vals_begin);
+    auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
+    using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+    detail::openmp::sort(detail::UnstableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
+  }
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -260,10 +501,12 @@ stable_pairs(
     ValIter vals_begin,
     Compare comp)
 {
-  auto begin  = RAJA::zip(keys_begin, vals_begin);
-  auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
-  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
-  detail::openmp::sort(detail::StableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
+  if (!RAJA::detail::try_radix_sort_pairs(detail::openmp::RadixParts{}, keys_begin, keys_end, vals_begin, comp)) {
+    auto begin  = RAJA::zip(keys_begin, vals_begin);
+    auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
+    using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+    detail::openmp::sort(detail::StableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
+  }
 
   return resources::EventProxy<resources::Host>(host_res);
 }
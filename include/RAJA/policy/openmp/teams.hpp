@@ -18,6 +18,12 @@
 #ifndef RAJA_pattern_teams_openmp_HPP
 #define RAJA_pattern_teams_openmp_HPP
 
+#include <omp.h>
+
+#include <algorithm>
+#include <new>
+
+#include "RAJA/internal/MemUtils_CPU.hpp"
 #include "RAJA/pattern/teams/teams_core.hpp"
 #include "RAJA/policy/openmp/policy.hpp"
 
@@ -45,6 +51,171 @@ struct LaunchExecute<RAJA::expt::omp_launch_t> {
 };
 
 
+/*!
+ * \brief  Launch policy that groups the OpenMP threads into teams.
+ *
+ *         Each team is ThreadsPerTeam threads, or the number of threads in
+ *         the launch Resources when ThreadsPerTeam is 0, limited to the
+ *         available threads. Every team gets its own scratchpad of the
+ *         SharedMem size of the Resources and a barrier used by
+ *         LaunchContext::teamSync(). Use omp_team_loop to distribute team
+ *         indices over the teams and omp_team_thread_loop to distribute
+ *         iterations over the threads of a team.
+ *
+ *         Arrays declared RAJA_TEAM_SHARED are private to each host thread,
+ *         use LaunchContext::getSharedMemory for data shared by a team.
+ */
+template <int ThreadsPerTeam = 0>
+struct omp_team_launch_t {
+};
+
+template <int ThreadsPerTeam>
+struct LaunchExecute<RAJA::expt::omp_team_launch_t<ThreadsPerTeam>> {
+
+  //! bytes reserved for a team's barrier in front of its scratchpad
+  static constexpr size_t barrier_bytes =
+      RAJA_DIVIDE_CEILING_INT(sizeof(HostTeamBarrier), DATA_ALIGN) *
+      DATA_ALIGN;
+
+  template <typename BODY>
+  static void exec(LaunchContext const &ctx, BODY const &body)
+  {
+    const int max_threads = omp_get_max_threads();
+    const int requested_team_threads =
+        ThreadsPerTeam > 0 ? ThreadsPerTeam
+                           : ctx.threads.value[0] * ctx.threads.value[1] *
+                                 ctx.threads.value[2];
+    const int max_team_threads =
+        std::max(1, std::min(requested_team_threads, max_threads));
+    const int max_teams = max_threads / max_team_threads;
+
+    const size_t shared_mem_bytes =
+        RAJA_DIVIDE_CEILING_INT(ctx.shared_mem.value, DATA_ALIGN) *
+        DATA_ALIGN;
+    const size_t team_bytes = barrier_bytes + shared_mem_bytes;
+
+    char *team_storage = static_cast<char *>(
+        allocate_aligned(DATA_ALIGN, max_teams * team_bytes));
+    if (!team_storage) {
+      RAJA_ABORT_OR_THROW("Could not allocate host team storage");
+    }
+
+#pragma omp parallel num_threads(max_teams * max_team_threads)
+    {
+      // the runtime may provide fewer threads than requested
+      const int num_threads = omp_get_num_threads();
+      const int team_threads = std::min(max_team_threads, num_threads);
+      const int num_teams = num_threads / team_threads;
+
+#pragma omp single
+      for (int t = 0; t < num_teams; ++t) {
+        new (team_storage + t * team_bytes) HostTeamBarrier(team_threads);
+      }
+
+      const int tid = omp_get_thread_num();
+      const int team = tid / team_threads;
+      if (team < num_teams) {
+        char *storage = team_storage + team * team_bytes;
+
+        LaunchContext team_ctx(ctx);
+        team_ctx.host_team = team;
+        team_ctx.host_num_teams = num_teams;
+        team_ctx.host_team_thread = tid % team_threads;
+        team_ctx.host_num_team_threads = team_threads;
+        team_ctx.host_team_barrier =
+            reinterpret_cast<HostTeamBarrier *>(storage);
+        team_ctx.shared_mem_ptr =
+            shared_mem_bytes > 0 ? storage + barrier_bytes : nullptr;
+
+        using RAJA::internal::thread_privatize;
+        auto loop_body = thread_privatize(body);
+        loop_body.get_priv()(team_ctx);
+      }
+
+#pragma omp barrier
+#pragma omp single
+      for (int t = 0; t < num_teams; ++t) {
+        reinterpret_cast<HostTeamBarrier *>(team_storage + t * team_bytes)
+            ->~HostTeamBarrier();
+      }
+    }
+
+    free_aligned(team_storage);
+  }
+};
+
+//! distributes iterations over the teams of an omp_team_launch_t
+struct omp_team_loop;
+
+//! distributes iterations over the threads of a team of an omp_team_launch_t
+struct omp_team_thread_loop;
+
+template <typename SEGMENT>
+struct LoopExecute<omp_team_loop, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(LaunchContext const &ctx,
+                                                SEGMENT const &segment,
+                                                BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+    for (int i = ctx.host_team; i < len; i += ctx.host_num_teams) {
+      body(*(segment.begin() + i));
+    }
+  }
+};
+
+template <typename SEGMENT>
+struct LoopICountExecute<omp_team_loop, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(LaunchContext const &ctx,
+                                                SEGMENT const &segment,
+                                                BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+    for (int i = ctx.host_team; i < len; i += ctx.host_num_teams) {
+      body(*(segment.begin() + i), i);
+    }
+  }
+};
+
+template <typename SEGMENT>
+struct LoopExecute<omp_team_thread_loop, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(LaunchContext const &ctx,
+                                                SEGMENT const &segment,
+                                                BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+    for (int i = ctx.host_team_thread; i < len;
+         i += ctx.host_num_team_threads) {
+      body(*(segment.begin() + i));
+    }
+  }
+};
+
+template <typename SEGMENT>
+struct LoopICountExecute<omp_team_thread_loop, SEGMENT> {
+
+  template <typename BODY>
+  static RAJA_INLINE RAJA_HOST_DEVICE void exec(LaunchContext const &ctx,
+                                                SEGMENT const &segment,
+                                                BODY const &body)
+  {
+
+    const int len = segment.end() - segment.begin();
+    for (int i = ctx.host_team_thread; i < len;
+         i += ctx.host_num_team_threads) {
+      body(*(segment.begin() + i), i);
+    }
+  }
+};
+
 template <typename SEGMENT>
 struct LoopExecute<omp_parallel_for_exec, SEGMENT> {
 
@@ -22,6 +22,8 @@
 
 #include "RAJA/policy/simd/forall.hpp"
 #include "RAJA/policy/simd/policy.hpp"
+#include "RAJA/policy/simd/register.hpp"
+#include "RAJA/index/VectorIndex.hpp"
 #include "RAJA/policy/loop/teams.hpp"
 #include "RAJA/policy/simd/kernel/For.hpp"
 #include "RAJA/policy/simd/kernel/ForICount.hpp"
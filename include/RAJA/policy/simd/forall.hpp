@@ -33,6 +33,9 @@
 
 #include "RAJA/util/types.hpp"
 
+#include "RAJA/index/RangeSegment.hpp"
+#include "RAJA/index/VectorIndex.hpp"
+
 #include "RAJA/internal/fault_tolerance.hpp"
 
 #include "RAJA/policy/simd/policy.hpp"
@@ -62,6 +65,46 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(RAJA::resources::
   return RAJA::resources::EventProxy<resources::Host>(host_res);
 }
 
+/*!
+ * Full runs are passed to the body in order, followed by the shorter
+ * remainder, if there is one.
+ */
+template <typename VECTOR_TYPE,
+          typename StorageT,
+          typename DiffT,
+          typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(
+    RAJA::resources::Host host_res,
+    const vector_exec<VECTOR_TYPE> &,
+    TypedVectorRangeSegment<StorageT, VECTOR_TYPE, DiffT> const &iter,
+    Func &&loop_body)
+{
+  auto begin = iter.begin();
+  auto distance = iter.size();
+  for (decltype(distance) i = 0; i < distance; ++i) {
+    loop_body(begin[i]);
+  }
+
+  return RAJA::resources::EventProxy<resources::Host>(host_res);
+}
+
+template <typename VECTOR_TYPE,
+          typename StorageT,
+          typename DiffT,
+          typename Func>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(
+    RAJA::resources::Host host_res,
+    const vector_exec<VECTOR_TYPE> &exec,
+    TypedRangeSegment<StorageT, DiffT> const &iter,
+    Func &&loop_body)
+{
+  return forall_impl(host_res,
+                     exec,
+                     TypedVectorRangeSegment<StorageT, VECTOR_TYPE, DiffT>(
+                         iter),
+                     std::forward<Func>(loop_body));
+}
+
 }  // namespace simd
 
 }  // namespace policy
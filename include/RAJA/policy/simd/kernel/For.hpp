@@ -129,6 +129,42 @@ struct StatementExecutor<
 };
 
 
+/*!
+ * RAJA::kernel executor specialization for statement::For with
+ * RAJA::vector_exec. The segment for ArgumentId must be a
+ * TypedVectorRangeSegment, so lambdas receive a VectorIndex for it.
+ */
+template <camp::idx_t ArgumentId,
+          typename VECTOR_TYPE,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<
+    statement::For<ArgumentId, RAJA::vector_exec<VECTOR_TYPE>, EnclosedStmts...>,
+    Types> {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data &&data)
+  {
+    using index_type =
+        camp::at_v<typename camp::decay<Data>::index_tuple_t::TList,
+                   ArgumentId>;
+    static_assert(std::is_same<typename index_type::vector_type,
+                               VECTOR_TYPE>::value,
+                  "RAJA::vector_exec requires a TypedVectorRangeSegment of "
+                  "the same vector type");
+
+    // Set the argument type for this loop
+    using NewTypes = setSegmentTypeFromData<Types, ArgumentId, Data>;
+
+    auto len = segment_length<ArgumentId>(data);
+    for (decltype(len) i = 0; i < len; ++i) {
+      data.template assign_offset<ArgumentId>(i);
+      execute_statement_list<camp::list<EnclosedStmts...>, NewTypes>(data);
+    }
+  }
+};
+
+
 }  // namespace internal
 }  // end namespace RAJA
 
@@ -44,11 +44,25 @@ struct simd_exec : make_policy_pattern_launch_platform_t<Policy::sequential,
                                                          Platform::host> {
 };
 
+/*!
+ * Iterates a contiguous range in runs of VECTOR_TYPE::s_num_elem indices,
+ * passing each run to the loop body as a RAJA::VectorIndex.
+ */
+template <typename VECTOR_TYPE>
+struct vector_exec
+    : make_policy_pattern_launch_platform_t<Policy::sequential,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+  using vector_type = VECTOR_TYPE;
+};
+
 }  // end of namespace simd
 
 }  // end of namespace policy
 
 using policy::simd::simd_exec;
+using policy::simd::vector_exec;
 
 }  // end of namespace RAJA
 
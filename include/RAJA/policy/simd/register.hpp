@@ -0,0 +1,677 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file containing the RAJA SIMD vector register type.
+ *
+ *          VectorRegister holds one hardware vector register worth of
+ *          values. Its width is chosen at compile time from a register
+ *          policy, which by default is the widest instruction set the host
+ *          compiler targets.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_simd_register_HPP
+#define RAJA_policy_simd_register_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
+#include "RAJA/util/macros.hpp"
+
+//
+// GCC-style vector extensions give guaranteed vector code for the
+// elementwise operations. Other compilers, and device compilation passes,
+// fall back to a plain array with SIMD-annotated loops.
+//
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(__CUDACC__) && \
+    !defined(__HIPCC__)
+#define RAJA_SIMD_VECTOR_EXTENSIONS
+#endif
+
+#if defined(RAJA_SIMD_VECTOR_EXTENSIONS) && \
+    (defined(__AVX__) || defined(__AVX512F__))
+#include <immintrin.h>
+#endif
+
+namespace RAJA
+{
+
+///
+/// Register policies, named for the instruction set whose register width
+/// they describe.
+///
+struct scalar_register {
+  static constexpr size_t s_bytes = 0;
+};
+
+struct sse_register {
+  static constexpr size_t s_bytes = 16;
+};
+
+struct avx_register {
+  static constexpr size_t s_bytes = 32;
+};
+
+struct avx2_register {
+  static constexpr size_t s_bytes = 32;
+};
+
+struct avx512_register {
+  static constexpr size_t s_bytes = 64;
+};
+
+//! widest register the host compiler is targeting
+#if defined(__AVX512F__)
+using default_register = avx512_register;
+#elif defined(__AVX2__)
+using default_register = avx2_register;
+#elif defined(__AVX__)
+using default_register = avx_register;
+#elif defined(__SSE2__) || defined(_M_X64)
+using default_register = sse_register;
+#else
+using default_register = scalar_register;
+#endif
+
+namespace detail
+{
+
+//! number of T that fit in a register of REGISTER_POLICY, at least one
+template <typename REGISTER_POLICY, typename T>
+struct register_num_elem
+    : std::integral_constant<camp::idx_t,
+                             (REGISTER_POLICY::s_bytes / sizeof(T) > 0)
+                                 ? camp::idx_t(REGISTER_POLICY::s_bytes /
+                                               sizeof(T))
+                                 : camp::idx_t(1)> {
+};
+
+//! register storage for compilers without vector extensions
+template <typename T, camp::idx_t N>
+struct RegisterArray {
+  T m_value[N];
+
+  RAJA_INLINE T& operator[](camp::idx_t i) { return m_value[i]; }
+  RAJA_INLINE T const& operator[](camp::idx_t i) const { return m_value[i]; }
+
+#define RAJA_REGISTER_ARRAY_OP(OP)                                   \
+  RAJA_INLINE RegisterArray operator OP(RegisterArray const& b) const \
+  {                                                                  \
+    RegisterArray r;                                                 \
+    RAJA_SIMD                                                        \
+    for (camp::idx_t i = 0; i < N; ++i) {                            \
+      r.m_value[i] = m_value[i] OP b.m_value[i];                     \
+    }                                                                \
+    return r;                                                        \
+  }
+
+  RAJA_REGISTER_ARRAY_OP(+)
+  RAJA_REGISTER_ARRAY_OP(-)
+  RAJA_REGISTER_ARRAY_OP(*)
+  RAJA_REGISTER_ARRAY_OP(/)
+
+#undef RAJA_REGISTER_ARRAY_OP
+};
+
+template <typename T, camp::idx_t N>
+struct register_storage {
+#if defined(RAJA_SIMD_VECTOR_EXTENSIONS)
+  typedef T type __attribute__((vector_size(N * sizeof(T))));
+#else
+  using type = RegisterArray<T, N>;
+#endif
+};
+
+//! a single lane is kept as an array so scalar_register stays scalar code
+template <typename T>
+struct register_storage<T, 1> {
+  using type = RegisterArray<T, 1>;
+};
+
+/*!
+ * \brief  Loads and stores that need more than elementwise arithmetic.
+ *
+ *         The generic versions work lane by lane; the specializations below
+ *         use masked and gather instructions where the instruction set has
+ *         them. Lanes at or past n are zero after a partial load.
+ */
+template <typename REGISTER_POLICY, typename T, camp::idx_t N>
+struct RegisterOps {
+  using storage_type = typename register_storage<T, N>::type;
+
+  static RAJA_INLINE void load_n(storage_type& v, T const* ptr, camp::idx_t n)
+  {
+    for (camp::idx_t i = 0; i < N; ++i) {
+      v[i] = i < n ? ptr[i] : T(0);
+    }
+  }
+
+  static RAJA_INLINE void store_n(storage_type const& v,
+                                  T* ptr,
+                                  camp::idx_t n)
+  {
+    for (camp::idx_t i = 0; i < n; ++i) {
+      ptr[i] = v[i];
+    }
+  }
+
+  template <typename OFFSET>
+  static RAJA_INLINE void gather_n(storage_type& v,
+                                   T const* ptr,
+                                   OFFSET const* offsets,
+                                   camp::idx_t n)
+  {
+    for (camp::idx_t i = 0; i < N; ++i) {
+      v[i] = i < n ? ptr[offsets[i]] : T(0);
+    }
+  }
+};
+
+#if defined(RAJA_SIMD_VECTOR_EXTENSIONS) && defined(__AVX__)
+
+template <>
+struct RegisterOps<avx_register, double, 4>
+    : RegisterOps<scalar_register, double, 4> {
+  using storage_type = register_storage<double, 4>::type;
+  using RegisterOps<scalar_register, double, 4>::gather_n;
+
+  static RAJA_INLINE __m256i mask(camp::idx_t n)
+  {
+    return _mm256_setr_epi64x(-(0 < n), -(1 < n), -(2 < n), -(3 < n));
+  }
+
+  static RAJA_INLINE void load_n(storage_type& v,
+                                 double const* ptr,
+                                 camp::idx_t n)
+  {
+    v = (storage_type)_mm256_maskload_pd(ptr, mask(n));
+  }
+
+  static RAJA_INLINE void store_n(storage_type const& v,
+                                  double* ptr,
+                                  camp::idx_t n)
+  {
+    _mm256_maskstore_pd(ptr, mask(n), (__m256d)v);
+  }
+};
+
+template <>
+struct RegisterOps<avx_register, float, 8>
+    : RegisterOps<scalar_register, float, 8> {
+  using storage_type = register_storage<float, 8>::type;
+  using RegisterOps<scalar_register, float, 8>::gather_n;
+
+  static RAJA_INLINE __m256i mask(camp::idx_t n)
+  {
+    return _mm256_setr_epi32(-(0 < n),
+                             -(1 < n),
+                             -(2 < n),
+                             -(3 < n),
+                             -(4 < n),
+                             -(5 < n),
+                             -(6 < n),
+                             -(7 < n));
+  }
+
+  static RAJA_INLINE void load_n(storage_type& v,
+                                 float const* ptr,
+                                 camp::idx_t n)
+  {
+    v = (storage_type)_mm256_maskload_ps(ptr, mask(n));
+  }
+
+  static RAJA_INLINE void store_n(storage_type const& v,
+                                  float* ptr,
+                                  camp::idx_t n)
+  {
+    _mm256_maskstore_ps(ptr, mask(n), (__m256)v);
+  }
+};
+
+#endif
+
+#if defined(RAJA_SIMD_VECTOR_EXTENSIONS) && defined(__AVX2__)
+
+template <>
+struct RegisterOps<avx2_register, double, 4>
+    : RegisterOps<avx_register, double, 4> {
+  using RegisterOps<avx_register, double, 4>::gather_n;
+
+  static RAJA_INLINE void gather_n(storage_type& v,
+                                   double const* ptr,
+                                   int const* offsets,
+                                   camp::idx_t n)
+  {
+    __m128i idx = _mm_setr_epi32(0 < n ? offsets[0] : 0,
+                                 1 < n ? offsets[1] : 0,
+                                 2 < n ? offsets[2] : 0,
+                                 3 < n ? offsets[3] : 0);
+    v = (storage_type)_mm256_mask_i32gather_pd(
+        _mm256_setzero_pd(), ptr, idx, _mm256_castsi256_pd(mask(n)), 8);
+  }
+};
+
+template <>
+struct RegisterOps<avx2_register, float, 8>
+    : RegisterOps<avx_register, float, 8> {
+  using RegisterOps<avx_register, float, 8>::gather_n;
+
+  static RAJA_INLINE void gather_n(storage_type& v,
+                                   float const* ptr,
+                                   int const* offsets,
+                                   camp::idx_t n)
+  {
+    __m256i m = mask(n);
+    __m256i idx = _mm256_maskload_epi32(offsets, m);
+    v = (storage_type)_mm256_mask_i32gather_ps(
+        _mm256_setzero_ps(), ptr, idx, _mm256_castsi256_ps(m), 4);
+  }
+};
+
+#endif
+
+#if defined(RAJA_SIMD_VECTOR_EXTENSIONS) && defined(__AVX512F__)
+
+template <>
+struct RegisterOps<avx512_register, double, 8>
+    : RegisterOps<scalar_register, double, 8> {
+  using storage_type = register_storage<double, 8>::type;
+  using RegisterOps<scalar_register, double, 8>::gather_n;
+
+  static RAJA_INLINE __mmask8 mask(camp::idx_t n)
+  {
+    return static_cast<__mmask8>(n >= 8 ? 0xff : (1u << n) - 1u);
+  }
+
+  static RAJA_INLINE void load_n(storage_type& v,
+                                 double const* ptr,
+                                 camp::idx_t n)
+  {
+    v = (storage_type)_mm512_maskz_loadu_pd(mask(n), ptr);
+  }
+
+  static RAJA_INLINE void store_n(storage_type const& v,
+                                  double* ptr,
+                                  camp::idx_t n)
+  {
+    _mm512_mask_storeu_pd(ptr, mask(n), (__m512d)v);
+  }
+
+  static RAJA_INLINE void gather_n(storage_type& v,
+                                   double const* ptr,
+                                   int const* offsets,
+                                   camp::idx_t n)
+  {
+    __m256i idx = _mm256_setr_epi32(0 < n ? offsets[0] : 0,
+                                    1 < n ? offsets[1] : 0,
+                                    2 < n ? offsets[2] : 0,
+                                    3 < n ? offsets[3] : 0,
+                                    4 < n ? offsets[4] : 0,
+                                    5 < n ? offsets[5] : 0,
+                                    6 < n ? offsets[6] : 0,
+                                    7 < n ? offsets[7] : 0);
+    v = (storage_type)_mm512_mask_i32gather_pd(
+        _mm512_setzero_pd(), mask(n), idx, ptr, 8);
+  }
+};
+
+template <>
+struct RegisterOps<avx512_register, float, 16>
+    : RegisterOps<scalar_register, float, 16> {
+  using storage_type = register_storage<float, 16>::type;
+  using RegisterOps<scalar_register, float, 16>::gather_n;
+
+  static RAJA_INLINE __mmask16 mask(camp::idx_t n)
+  {
+    return static_cast<__mmask16>(n >= 16 ? 0xffff : (1u << n) - 1u);
+  }
+
+  static RAJA_INLINE void load_n(storage_type& v,
+                                 float const* ptr,
+                                 camp::idx_t n)
+  {
+    v = (storage_type)_mm512_maskz_loadu_ps(mask(n), ptr);
+  }
+
+  static RAJA_INLINE void store_n(storage_type const& v,
+                                  float* ptr,
+                                  camp::idx_t n)
+  {
+    _mm512_mask_storeu_ps(ptr, mask(n), (__m512)v);
+  }
+
+  static RAJA_INLINE void gather_n(storage_type& v,
+                                   float const* ptr,
+                                   int const* offsets,
+                                   camp::idx_t n)
+  {
+    __mmask16 m = mask(n);
+    __m512i idx = _mm512_maskz_loadu_epi32(m, offsets);
+    v = (storage_type)_mm512_mask_i32gather_ps(
+        _mm512_setzero_ps(), m, idx, ptr, 4);
+  }
+};
+
+#endif
+
+}  // namespace detail
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  One SIMD register of element type T.
+ *
+ * \tparam T  arithmetic element type
+ * \tparam REGISTER_POLICY  register width, default_register picks the widest
+ *         instruction set enabled for the host compiler
+ *
+ * The "_n" variants of the load and store methods only touch the first n
+ * lanes and are used for the remainder at the end of a loop. A partial load
+ * leaves the remaining lanes zero, so sum() and dot() can be used on it
+ * directly; use max_n() and min_n() for the other horizontal reductions.
+ *
+ * Usage:
+ *
+ * \verbatim
+ *
+ *   using vec_t = RAJA::VectorRegister<double>;
+ *
+ *   vec_t x, y;
+ *   x.load_packed(a + i);
+ *   y.load_packed(b + i);
+ *   x.fused_multiply_add(y, vec_t(2.0)).store_packed(c + i);
+ *
+ * \endverbatim
+ *
+ ******************************************************************************
+ */
+template <typename T, typename REGISTER_POLICY = default_register>
+class VectorRegister
+{
+  static_assert(std::is_arithmetic<T>::value,
+                "VectorRegister element type must be arithmetic");
+
+public:
+  using register_policy = REGISTER_POLICY;
+  using element_type = T;
+
+  //! number of lanes in the register
+  static constexpr camp::idx_t s_num_elem =
+      detail::register_num_elem<REGISTER_POLICY, T>::value;
+
+private:
+  using ops = detail::RegisterOps<REGISTER_POLICY, T, s_num_elem>;
+  using storage_type = typename detail::register_storage<T, s_num_elem>::type;
+
+  storage_type m_value;
+
+  RAJA_INLINE explicit VectorRegister(storage_type const& v) : m_value(v) {}
+
+public:
+  //! all lanes zero
+  RAJA_INLINE VectorRegister() { broadcast(T(0)); }
+
+  //! all lanes c
+  RAJA_INLINE explicit VectorRegister(element_type const& c) { broadcast(c); }
+
+  static constexpr camp::idx_t num_elem() { return s_num_elem; }
+
+  RAJA_INLINE VectorRegister& broadcast(element_type const& c)
+  {
+    for (camp::idx_t i = 0; i < s_num_elem; ++i) {
+      m_value[i] = c;
+    }
+    return *this;
+  }
+
+  RAJA_INLINE element_type get(camp::idx_t i) const { return m_value[i]; }
+
+  RAJA_INLINE VectorRegister& set(camp::idx_t i, element_type const& c)
+  {
+    m_value[i] = c;
+    return *this;
+  }
+
+  //@{
+  //!   @name Loads, ptr does not need to be aligned
+
+  RAJA_INLINE VectorRegister& load_packed(element_type const* ptr)
+  {
+    std::memcpy(&m_value, ptr, sizeof(m_value));
+    return *this;
+  }
+
+  RAJA_INLINE VectorRegister& load_packed_n(element_type const* ptr,
+                                            camp::idx_t n)
+  {
+    ops::load_n(m_value, ptr, n);
+    return *this;
+  }
+
+  RAJA_INLINE VectorRegister& load_strided(element_type const* ptr,
+                                           camp::idx_t stride)
+  {
+    for (camp::idx_t i = 0; i < s_num_elem; ++i) {
+      m_value[i] = ptr[i * stride];
+    }
+    return *this;
+  }
+
+  RAJA_INLINE VectorRegister& load_strided_n(element_type const* ptr,
+                                             camp::idx_t stride,
+                                             camp::idx_t n)
+  {
+    for (camp::idx_t i = 0; i < s_num_elem; ++i) {
+      m_value[i] = i < n ? ptr[i * stride] : element_type(0);
+    }
+    return *this;
+  }
+
+  //! lane i is ptr[offsets[i]]
+  template <typename OFFSET>
+  RAJA_INLINE VectorRegister& gather(element_type const* ptr,
+                                     OFFSET const* offsets)
+  {
+    ops::gather_n(m_value, ptr, offsets, s_num_elem);
+    return *this;
+  }
+
+  template <typename OFFSET>
+  RAJA_INLINE VectorRegister& gather_n(element_type const* ptr,
+                                       OFFSET const* offsets,
+                                       camp::idx_t n)
+  {
+    ops::gather_n(m_value, ptr, offsets, n);
+    return *this;
+  }
+
+  //@}
+
+  //@{
+  //!   @name Stores, ptr does not need to be aligned
+
+  RAJA_INLINE VectorRegister const& store_packed(element_type* ptr) const
+  {
+    std::memcpy(ptr, &m_value, sizeof(m_value));
+    return *this;
+  }
+
+  RAJA_INLINE VectorRegister const& store_packed_n(element_type* ptr,
+                                                   camp::idx_t n) const
+  {
+    ops::store_n(m_value, ptr, n);
+    return *this;
+  }
+
+  RAJA_INLINE VectorRegister const& store_strided(element_type* ptr,
+                                                  camp::idx_t stride) const
+  {
+    for (camp::idx_t i = 0; i < s_num_elem; ++i) {
+      ptr[i * stride] = m_value[i];
+    }
+    return *this;
+  }
+
+  RAJA_INLINE VectorRegister const& store_strided_n(element_type* ptr,
+                                                    camp::idx_t stride,
+                                                    camp::idx_t n) const
+  {
+    for (camp::idx_t i = 0; i < n; ++i) {
+      ptr[i * stride] = m_value[i];
+    }
+    return *this;
+  }
+
+  //@}
+
+  //@{
+  //!   @name Elementwise arithmetic
+
+  RAJA_INLINE VectorRegister operator+(VectorRegister const& b) const
+  {
+    return VectorRegister(m_value + b.m_value);
+  }
+
+  RAJA_INLINE VectorRegister operator-(VectorRegister const& b) const
+  {
+    return VectorRegister(m_value - b.m_value);
+  }
+
+  RAJA_INLINE VectorRegister operator*(VectorRegister const& b) const
+  {
+    return VectorRegister(m_value * b.m_value);
+  }
+
+  RAJA_INLINE VectorRegister operator/(VectorRegister const& b) const
+  {
+    return VectorRegister(m_value / b.m_value);
+  }
+
+  RAJA_INLINE VectorRegister operator-() const
+  {
+    return VectorRegister() - *this;
+  }
+
+  RAJA_INLINE VectorRegister& operator+=(VectorRegister const& b)
+  {
+    m_value = m_value + b.m_value;
+    return *this;
+  }
+
+  RAJA_INLINE VectorRegister& operator-=(VectorRegister const& b)
+  {
+    m_value = m_value - b.m_value;
+    return *this;
+  }
+
+  RAJA_INLINE VectorRegister& operator*=(VectorRegister const& b)
+  {
+    m_value = m_value * b.m_value;
+    return *this;
+  }
+
+  RAJA_INLINE VectorRegister& operator/=(VectorRegister const& b)
+  {
+    m_value = m_value / b.m_value;
+    return *this;
+  }
+
+  /*!
+   * \brief  Returns (*this) * b + c.
+   *
+   *         Written as one expression so the compiler contracts it into a
+   *         fused multiply-add where the target has one.
+   */
+  RAJA_INLINE VectorRegister fused_multiply_add(VectorRegister const& b,
+                                                VectorRegister const& c) const
+  {
+    return VectorRegister(m_value * b.m_value + c.m_value);
+  }
+
+  //! elementwise minimum
+  RAJA_INLINE VectorRegister vmin(VectorRegister const& b) const
+  {
+    VectorRegister r;
+    for (camp::idx_t i = 0; i < s_num_elem; ++i) {
+      r.m_value[i] = b.m_value[i] < m_value[i] ? b.m_value[i] : m_value[i];
+    }
+    return r;
+  }
+
+  //! elementwise maximum
+  RAJA_INLINE VectorRegister vmax(VectorRegister const& b) const
+  {
+    VectorRegister r;
+    for (camp::idx_t i = 0; i < s_num_elem; ++i) {
+      r.m_value[i] = m_value[i] < b.m_value[i] ? b.m_value[i] : m_value[i];
+    }
+    return r;
+  }
+
+  //@}
+
+  //@{
+  //!   @name Horizontal reductions
+
+  RAJA_INLINE element_type sum() const
+  {
+    element_type r = m_value[0];
+    for (camp::idx_t i = 1; i < s_num_elem; ++i) {
+      r += m_value[i];
+    }
+    return r;
+  }
+
+  RAJA_INLINE element_type dot(VectorRegister const& b) const
+  {
+    return (*this * b).sum();
+  }
+
+  //! maximum of the first n lanes, n must be at least one
+  RAJA_INLINE element_type max_n(camp::idx_t n) const
+  {
+    element_type r = m_value[0];
+    for (camp::idx_t i = 1; i < n; ++i) {
+      r = r < m_value[i] ? m_value[i] : r;
+    }
+    return r;
+  }
+
+  //! minimum of the first n lanes, n must be at least one
+  RAJA_INLINE element_type min_n(camp::idx_t n) const
+  {
+    element_type r = m_value[0];
+    for (camp::idx_t i = 1; i < n; ++i) {
+      r = m_value[i] < r ? m_value[i] : r;
+    }
+    return r;
+  }
+
+  RAJA_INLINE element_type max() const { return max_n(s_num_elem); }
+
+  RAJA_INLINE element_type min() const { return min_n(s_num_elem); }
+
+  //@}
+};
+
+template <typename T, typename REGISTER_POLICY>
+constexpr camp::idx_t VectorRegister<T, REGISTER_POLICY>::s_num_elem;
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
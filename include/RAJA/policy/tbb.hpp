@@ -22,11 +22,14 @@
 
 #if defined(RAJA_ENABLE_TBB)
 
+#include "RAJA/policy/tbb/atomic.hpp"
 #include "RAJA/policy/tbb/forall.hpp"
+#include "RAJA/policy/tbb/kernel.hpp"
 #include "RAJA/policy/tbb/policy.hpp"
 #include "RAJA/policy/tbb/reduce.hpp"
 #include "RAJA/policy/tbb/scan.hpp"
 #include "RAJA/policy/tbb/sort.hpp"
+#include "RAJA/policy/tbb/teams.hpp"
 #include "RAJA/policy/tbb/WorkGroup.hpp"
 
 #endif
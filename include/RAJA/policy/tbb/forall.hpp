@@ -51,6 +51,92 @@ namespace policy
 namespace tbb
 {
 
+namespace internal
+{
+
+//! affinity_partitioner of one calling thread for one loop
+struct tbb_affinity_slot {
+  ::tbb::affinity_partitioner partitioner;
+  bool in_use = false;
+};
+
+/*!
+ * \brief  The calling thread's affinity_partitioner for the loop whose
+ *         chunk body has type Body.
+ *
+ *         An affinity_partitioner only pays off when later runs of the same
+ *         loop reuse it, and two loops may not use it at the same time, so
+ *         one is kept per thread and per loop.
+ */
+template <typename Body>
+RAJA_INLINE tbb_affinity_slot& get_tbb_affinity_slot()
+{
+  static thread_local tbb_affinity_slot slot;
+  return slot;
+}
+
+//! tbb::parallel_for with the calling thread's affinity_partitioner
+template <typename Range, typename Body>
+RAJA_INLINE void parallel_for_affinity(Range const& range, Body const& body)
+{
+  tbb_affinity_slot& slot = get_tbb_affinity_slot<Body>();
+  if (slot.in_use) {
+    // the same loop is already running further up this thread's stack
+    ::tbb::parallel_for(range, body, ::tbb::auto_partitioner{});
+    return;
+  }
+
+  struct release_slot {
+    bool& in_use;
+    ~release_slot() { in_use = false; }
+  } release{slot.in_use};
+  slot.in_use = true;
+  ::tbb::parallel_for(range, body, slot.partitioner);
+}
+
+/*!
+ * \brief  Runs tbb::parallel_for with the partitioner and grain size of a
+ *         TBB loop policy, used by the kernel and launch executors.
+ */
+template <typename Policy>
+struct parallel_for_runner;
+
+//! kernel and launch policies are types, so the grain size is the default
+template <>
+struct parallel_for_runner<tbb_for_dynamic> {
+  static constexpr std::size_t grain_size = 1;
+
+  template <typename Range, typename Body>
+  static RAJA_INLINE void run(Range const& range, Body const& body)
+  {
+    ::tbb::parallel_for(range, body);
+  }
+};
+
+template <std::size_t GrainSize>
+struct parallel_for_runner<tbb_for_static<GrainSize>> {
+  static constexpr std::size_t grain_size = GrainSize;
+
+  template <typename Range, typename Body>
+  static RAJA_INLINE void run(Range const& range, Body const& body)
+  {
+    ::tbb::parallel_for(range, body, tbb_static_partitioner{});
+  }
+};
+
+template <std::size_t GrainSize>
+struct parallel_for_runner<tbb_for_affinity<GrainSize>> {
+  static constexpr std::size_t grain_size = GrainSize;
+
+  template <typename Range, typename Body>
+  static RAJA_INLINE void run(Range const& range, Body const& body)
+  {
+    parallel_for_affinity(range, body);
+  }
+};
+
+}  // namespace internal
+
 
 /**
  * @brief TBB dynamic for implementation
@@ -83,7 +169,7 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host h
   ::tbb::parallel_for(brange(0, dist, p.grain_size), [=](const brange& r) {
     using RAJA::internal::thread_privatize;
     auto privatizer = thread_privatize(loop_body);
-    auto body = privatizer.get_priv();
+    auto& body = privatizer.get_priv();
     for (auto i = r.begin(); i != r.end(); ++i)
       body(b[i]);
   });
@@ -128,7 +214,7 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host h
       [=](const brange& r) {
         using RAJA::internal::thread_privatize;
         auto privatizer = thread_privatize(loop_body);
-        auto body = privatizer.get_priv();
+        auto& body = privatizer.get_priv();
         for (auto i = r.begin(); i != r.end(); ++i)
           body(b[i]);
       },
@@ -137,6 +223,48 @@ RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host h
   return resources::EventProxy<resources::Host>(host_res);
 }
 
+/**
+ * @brief TBB affinity for implementation
+ *
+ * @param tbb_for_affinity tbb tag
+ * @param iter any iterable
+ * @param loop_body loop body
+ *
+ * @return None
+ *
+ * This forall implements a TBB parallel_for loop over the specified iterable
+ * using work stealing with an affinity_partitioner and the grain size
+ * specified as a compile-time constant in the policy argument. The
+ * partitioner is kept per calling thread and loop, so repeated executions
+ * of the loop tend to run each subrange on the thread that ran it before,
+ * which keeps its data in that thread's cache.
+ */
+
+template <typename Iterable, typename Func, size_t GrainSize>
+RAJA_INLINE resources::EventProxy<resources::Host> forall_impl(resources::Host host_res,
+                                                               const tbb_for_affinity<GrainSize>&,
+                                                               Iterable&& iter,
+                                                               Func&& loop_body)
+{
+  using std::begin;
+  using std::distance;
+  using std::end;
+  using brange = ::tbb::blocked_range<size_t>;
+  auto b = begin(iter);
+  size_t dist = std::abs(distance(begin(iter), end(iter)));
+  internal::parallel_for_affinity(
+      brange(0, dist, GrainSize),
+      [=](const brange& r) {
+        using RAJA::internal::thread_privatize;
+        auto privatizer = thread_privatize(loop_body);
+        auto& body = privatizer.get_priv();
+        for (auto i = r.begin(); i != r.end(); ++i)
+          body(b[i]);
+      });
+
+  return resources::EventProxy<resources::Host>(host_res);
+}
+
 }  // namespace tbb
 }  // namespace policy
 
@@ -0,0 +1,175 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing the TBB executors for
+ *          statement::Collapse.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_policy_tbb_kernel_collapse_HPP
+#define RAJA_policy_tbb_kernel_collapse_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_TBB)
+
+#include <tbb/tbb.h>
+
+#include "RAJA/pattern/detail/privatizer.hpp"
+
+#include "RAJA/pattern/kernel/Collapse.hpp"
+#include "RAJA/pattern/kernel/internal.hpp"
+
+#include "RAJA/util/macros.hpp"
+#include "RAJA/util/types.hpp"
+
+#include "RAJA/policy/tbb/forall.hpp"
+#include "RAJA/policy/tbb/policy.hpp"
+
+namespace RAJA
+{
+
+///
+///  Collapse policy for two or three loops that splits the loops as one
+///  blocked_range2d or blocked_range3d with work stealing.
+///
+///  LoopPolicy is tbb_for_affinity (the default), tbb_for_dynamic or
+///  tbb_for_static and selects the partitioner and grain size used for
+///  every collapsed loop.
+///
+template <typename LoopPolicy = policy::tbb::tbb_for_affinity<>>
+struct tbb_collapse_exec
+    : make_policy_pattern_launch_platform_t<Policy::tbb,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
+namespace internal
+{
+
+/////////
+// Collapsing two loops
+/////////
+
+template <typename LoopPolicy,
+          camp::idx_t Arg0,
+          camp::idx_t Arg1,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<statement::Collapse<tbb_collapse_exec<LoopPolicy>,
+                                             ArgList<Arg0, Arg1>,
+                                             EnclosedStmts...>,
+                         Types> {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data&& data)
+  {
+    using runner = RAJA::policy::tbb::internal::parallel_for_runner<LoopPolicy>;
+    using brange = ::tbb::blocked_range2d<Index_type>;
+
+    const Index_type l0 = segment_length<Arg0>(data);
+    const Index_type l1 = segment_length<Arg1>(data);
+
+    // Set the argument types for this loop
+    using NewTypes0 = setSegmentTypeFromData<Types, Arg0, Data>;
+    using NewTypes1 = setSegmentTypeFromData<NewTypes0, Arg1, Data>;
+
+    runner::run(
+        brange(0, l0, runner::grain_size, 0, l1, runner::grain_size),
+        [&](const brange& r) {
+          using RAJA::internal::thread_privatize;
+          auto privatizer = thread_privatize(data);
+          auto& private_data = privatizer.get_priv();
+          for (Index_type i0 = r.rows().begin(); i0 != r.rows().end(); ++i0) {
+            private_data.template assign_offset<Arg0>(i0);
+            for (Index_type i1 = r.cols().begin(); i1 != r.cols().end();
+                 ++i1) {
+              private_data.template assign_offset<Arg1>(i1);
+              execute_statement_list<camp::list<EnclosedStmts...>, NewTypes1>(
+                  private_data);
+            }
+          }
+        });
+  }
+};
+
+
+/////////
+// Collapsing three loops
+/////////
+
+template <typename LoopPolicy,
+          camp::idx_t Arg0,
+          camp::idx_t Arg1,
+          camp::idx_t Arg2,
+          typename... EnclosedStmts,
+          typename Types>
+struct StatementExecutor<statement::Collapse<tbb_collapse_exec<LoopPolicy>,
+                                             ArgList<Arg0, Arg1, Arg2>,
+                                             EnclosedStmts...>,
+                         Types> {
+
+  template <typename Data>
+  static RAJA_INLINE void exec(Data&& data)
+  {
+    using runner = RAJA::policy::tbb::internal::parallel_for_runner<LoopPolicy>;
+    using brange = ::tbb::blocked_range3d<Index_type>;
+
+    const Index_type l0 = segment_length<Arg0>(data);
+    const Index_type l1 = segment_length<Arg1>(data);
+    const Index_type l2 = segment_length<Arg2>(data);
+
+    // Set the argument types for this loop
+    using NewTypes0 = setSegmentTypeFromData<Types, Arg0, Data>;
+    using NewTypes1 = setSegmentTypeFromData<NewTypes0, Arg1, Data>;
+    using NewTypes2 = setSegmentTypeFromData<NewTypes1, Arg2, Data>;
+
+    runner::run(
+        brange(0,
+               l0,
+               runner::grain_size,
+               0,
+               l1,
+               runner::grain_size,
+               0,
+               l2,
+               runner::grain_size),
+        [&](const brange& r) {
+          using RAJA::internal::thread_privatize;
+          auto privatizer = thread_privatize(data);
+          auto& private_data = privatizer.get_priv();
+          for (Index_type i0 = r.pages().begin(); i0 != r.pages().end();
+               ++i0) {
+            private_data.template assign_offset<Arg0>(i0);
+            for (Index_type i1 = r.rows().begin(); i1 != r.rows().end();
+                 ++i1) {
+              private_data.template assign_offset<Arg1>(i1);
+              for (Index_type i2 = r.cols().begin(); i2 != r.cols().end();
+                   ++i2) {
+                private_data.template assign_offset<Arg2>(i2);
+                execute_statement_list<camp::list<EnclosedStmts...>,
+                                       NewTypes2>(private_data);
+              }
+            }
+          }
+        });
+  }
+};
+
+}  // namespace internal
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_TBB guard
+
+#endif  // closing endif for header file include guard
@@ -60,6 +60,19 @@ struct tbb_for_static : make_policy_pattern_launch_platform_t<Policy::tbb,
 
 using tbb_for_exec = tbb_for_static<>;
 
+///
+/// Work-stealing loop with an affinity_partitioner, so running the same loop
+/// again tends to give each thread the subranges it worked on last time.
+/// Suited to irregular loops that are executed repeatedly.
+///
+template <std::size_t GrainSize = 1>
+struct tbb_for_affinity
+    : make_policy_pattern_launch_platform_t<Policy::tbb,
+                                            Pattern::forall,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
 ///
 /// Index set segment iteration policies
 ///
@@ -88,13 +101,39 @@ struct tbb_reduce : make_policy_pattern_launch_platform_t<Policy::tbb,
                                                           Platform::host> {
 };
 
+///
+///  Reduction whose floating point sums do not depend on how the work is
+///  split across threads.
+///
+struct tbb_reduce_reproducible
+    : make_policy_pattern_launch_platform_t<Policy::tbb,
+                                            Pattern::reduce,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
+///
+///  Reduction whose partial result is kept in each blocked_range chunk's
+///  private copy of the loop body and folded into a per-thread slot once,
+///  when the chunk finishes.
+///
+struct tbb_reduce_chunked
+    : make_policy_pattern_launch_platform_t<Policy::tbb,
+                                            Pattern::reduce,
+                                            Launch::undefined,
+                                            Platform::host> {
+};
+
 }  // namespace tbb
 }  // namespace policy
 
 using policy::tbb::tbb_for_dynamic;
+using policy::tbb::tbb_for_affinity;
 using policy::tbb::tbb_for_exec;
 using policy::tbb::tbb_for_static;
 using policy::tbb::tbb_reduce;
+using policy::tbb::tbb_reduce_chunked;
+using policy::tbb::tbb_reduce_reproducible;
 using policy::tbb::tbb_segit;
 using policy::tbb::tbb_work;
 
@@ -86,6 +86,97 @@ public:
 
 RAJA_DECLARE_ALL_REDUCERS(tbb_reduce, detail::ReduceTBB)
 
+RAJA_DECLARE_REPRODUCIBLE_REDUCERS(tbb_reduce_reproducible, detail::ReduceTBB)
+
+namespace detail
+{
+
+/*!
+ * \brief  TBB reducer combiner that does no thread-local lookup in the
+ *         loop body.
+ *
+ *         The TBB forall policies give every blocked_range chunk its own
+ *         copy of the loop body, so each copy of the reducer accumulates
+ *         into a plain member and folds it into the calling thread's slot
+ *         of the original object once, when the chunk's copy is destroyed.
+ *         The slots are combined when the value is requested and are kept
+ *         across resets.
+ *
+ *         This is only race free when every chunk runs on its own copy of
+ *         the reducer, as in the TBB forall and kernel policies. Loops in a
+ *         tbb_launch_t launch usually capture the reducer by reference, so
+ *         privatizing their body does not copy it; use tbb_reduce there.
+ */
+template <typename T, typename Reduce>
+class ReduceTBBChunked
+    : public reduce::detail::
+          BaseCombinable<T, Reduce, ReduceTBBChunked<T, Reduce>>
+{
+  using Base = reduce::detail::BaseCombinable<T, Reduce, ReduceTBBChunked>;
+  using slots_type = tbb::enumerable_thread_specific<T>;
+  //! only used by the original object, copies leave it empty
+  std::unique_ptr<slots_type> slots;
+
+  const ReduceTBBChunked& root() const
+  {
+    return Base::parent ? *static_cast<const ReduceTBBChunked*>(Base::parent)
+                        : *this;
+  }
+
+public:
+  //! prohibit compiler-generated default ctor
+  ReduceTBBChunked() = delete;
+
+  //! constructor requires a default value for the reducer
+  ReduceTBBChunked(T init_val, T identity_)
+      : Base(init_val, identity_), slots(new slots_type())
+  {
+  }
+
+  //! copies share the slots of the original reducer
+  ReduceTBBChunked(const ReduceTBBChunked& other) : Base(other) {}
+
+  void reset(T init_val, T identity_)
+  {
+    Base::reset(init_val, identity_);
+    if (!Base::parent) {
+      for (T& slot : *slots) {
+        slot = identity_;
+      }
+    }
+  }
+
+  ~ReduceTBBChunked()
+  {
+    if (Base::parent) {
+      if (Base::my_data != Base::identity) {
+        const ReduceTBBChunked& r = root();
+        bool exists = false;
+        T& slot = r.slots->local(exists);
+        if (!exists) {
+          slot = r.identity;
+        }
+        Reduce{}(slot, Base::my_data);
+      }
+      Base::my_data = Base::identity;
+    }
+  }
+
+  T get_combined() const
+  {
+    const ReduceTBBChunked& r = root();
+    for (T& slot : *r.slots) {
+      Reduce{}(r.my_data, slot);
+      slot = r.identity;
+    }
+    return r.my_data;
+  }
+};
+
+}  // namespace detail
+
+RAJA_DECLARE_ALL_REDUCERS(tbb_reduce_chunked, detail::ReduceTBBChunked)
+
 }  // namespace RAJA
 
 #endif  // closing endif for RAJA_ENABLE_TBB guard
@@ -129,6 +129,31 @@ void tbb_sort(Sorter sorter,
   }
 }
 
+/*!
+        \brief runs the parts of a radix sort pass as tbb tasks
+*/
+struct TbbRadixParts
+{
+  size_t num_parts(size_t n) const
+  {
+    const size_t max_parts = n / RAJA::detail::radix_sort_min_items_per_part();
+    const size_t num_threads = tbb::task_scheduler_init::default_num_threads();
+    return std::max(std::min(num_threads, max_parts), static_cast<size_t>(1));
+  }
+
+  template <typename Func>
+  void operator()(size_t num, Func&& func) const
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, num, 1),
+                      [&](const tbb::blocked_range<size_t>& r) {
+                        for (size_t part = r.begin(); part != r.end(); ++part) {
+                          func(part);
+                        }
+                      },
+                      tbb::simple_partitioner());
+  }
+};
+
 } // namespace detail
 
 /*!
@@ -144,7 +169,9 @@ unstable(
     Iter end,
     Compare comp)
 {
-  tbb::parallel_sort(begin, end, comp);
+  if (!RAJA::detail::try_radix_sort(detail::TbbRadixParts{}, begin, end, comp)) {
+    tbb::parallel_sort(begin, end, comp);
+  }
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -162,7 +189,9 @@ stable(
     Iter end,
     Compare comp)
 {
-  detail::tbb_sort(detail::StableSorter{}, begin, end, comp);
+  if (!RAJA::detail::try_radix_sort(detail::TbbRadixParts{}, begin, end, comp)) {
+    detail::tbb_sort(detail::StableSorter{}, begin, end, comp);
+  }
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -181,10 +210,12 @@ unstable_pairs(
     ValIter vals_begin,
     Compare comp)
 {
-  auto begin  = RAJA::zip(keys_begin, vals_begin);
-  auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
-  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
-  detail::tbb_sort(detail::UnstableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
+  if (!RAJA::detail::try_radix_sort_pairs(detail::TbbRadixParts{}, keys_begin, keys_end, vals_begin, comp)) {
+    auto begin  = RAJA::zip(keys_begin, vals_begin);
+    auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
+    using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+    detail::tbb_sort(detail::UnstableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
+  }
 
   return resources::EventProxy<resources::Host>(host_res);
 }
@@ -203,10 +234,12 @@ stable_pairs(
     ValIter vals_begin,
     Compare comp)
 {
-  auto begin  = RAJA::zip(keys_begin, vals_begin);
-  auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
-  using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
-  detail::tbb_sort(detail::StableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
+  if (!RAJA::detail::try_radix_sort_pairs(detail::TbbRadixParts{}, keys_begin, keys_end, vals_begin, comp)) {
+    auto begin  = RAJA::zip(keys_begin, vals_begin);
+    auto end    = RAJA::zip(keys_end, vals_begin+(keys_end-keys_begin));
+    using zip_ref = RAJA::detail::IterRef<camp::decay<decltype(begin)>>;
+    detail::tbb_sort(detail::StableSorter{}, begin, end, RAJA::compare_first<zip_ref>(comp));
+  }
 
   return resources::EventProxy<resources::Host>(host_res);
 }
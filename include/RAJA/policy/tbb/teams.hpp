@@ -0,0 +1,336 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file containing user interface for RAJA::Teams::tbb
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_pattern_teams_tbb_HPP
+#define RAJA_pattern_teams_tbb_HPP
+
+#include "RAJA/config.hpp"
+
+#if defined(RAJA_ENABLE_TBB)
+
+#include <tbb/tbb.h>
+
+#include "RAJA/pattern/detail/privatizer.hpp"
+#include "RAJA/pattern/teams/teams_core.hpp"
+#include "RAJA/policy/loop/teams.hpp"
+#include "RAJA/policy/tbb/forall.hpp"
+#include "RAJA/policy/tbb/policy.hpp"
+
+
+namespace RAJA
+{
+
+namespace expt
+{
+
+/*!
+ * \brief  Launch policy for TBB loops.
+ *
+ *         The launch body runs once on the calling thread, like
+ *         seq_launch_t, and the loops inside it that use a TBB loop policy
+ *         are split with tbb::parallel_for, so teams are load balanced by
+ *         work stealing. The SharedMem of the launch Resources is a single
+ *         scratchpad, do not use it from loops that run in parallel.
+ */
+struct tbb_launch_t {
+};
+
+template <>
+struct LaunchExecute<RAJA::expt::tbb_launch_t>
+    : LaunchExecute<RAJA::expt::seq_launch_t> {
+};
+
+namespace detail
+{
+
+/*!
+ * \brief  loop and loop_icount for the TBB loop policies, 2 and 3
+ *         segments are split as a blocked_range2d and blocked_range3d.
+ *
+ *         Loop policies are passed as types, so tbb_for_dynamic always uses
+ *         a grain size of 1 here; use tbb_for_static<GrainSize> or
+ *         tbb_for_affinity<GrainSize> to split fine-grained loops less.
+ */
+template <typename POLICY, typename SEGMENT, bool ICount>
+struct TBBLoopExecute {
+
+  using runner = RAJA::policy::tbb::internal::parallel_for_runner<POLICY>;
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+    using brange = ::tbb::blocked_range<int>;
+
+    const int len = segment.end() - segment.begin();
+
+    runner::run(brange(0, len, runner::grain_size), [&](const brange &r) {
+      using RAJA::internal::thread_privatize;
+      auto privatizer = thread_privatize(body);
+      auto &loop_body = privatizer.get_priv();
+      for (int i = r.begin(); i != r.end(); ++i) {
+        call(loop_body, camp::num<ICount>{}, *(segment.begin() + i), i);
+      }
+    });
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               SEGMENT const &segment0,
+                               SEGMENT const &segment1,
+                               BODY const &body)
+  {
+    using brange = ::tbb::blocked_range2d<int>;
+
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    runner::run(brange(0,
+                       len1,
+                       runner::grain_size,
+                       0,
+                       len0,
+                       runner::grain_size),
+                [&](const brange &r) {
+                  using RAJA::internal::thread_privatize;
+                  auto privatizer = thread_privatize(body);
+                  auto &loop_body = privatizer.get_priv();
+                  for (int j = r.rows().begin(); j != r.rows().end(); ++j) {
+                    for (int i = r.cols().begin(); i != r.cols().end(); ++i) {
+                      call(loop_body,
+                           camp::num<ICount>{},
+                           *(segment0.begin() + i),
+                           *(segment1.begin() + j),
+                           i,
+                           j);
+                    }
+                  }
+                });
+  }
+
+  template <typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               SEGMENT const &segment0,
+                               SEGMENT const &segment1,
+                               SEGMENT const &segment2,
+                               BODY const &body)
+  {
+    using brange = ::tbb::blocked_range3d<int>;
+
+    const int len2 = segment2.end() - segment2.begin();
+    const int len1 = segment1.end() - segment1.begin();
+    const int len0 = segment0.end() - segment0.begin();
+
+    runner::run(brange(0,
+                       len2,
+                       runner::grain_size,
+                       0,
+                       len1,
+                       runner::grain_size,
+                       0,
+                       len0,
+                       runner::grain_size),
+                [&](const brange &r) {
+                  using RAJA::internal::thread_privatize;
+                  auto privatizer = thread_privatize(body);
+                  auto &loop_body = privatizer.get_priv();
+                  for (int k = r.pages().begin(); k != r.pages().end(); ++k) {
+                    for (int j = r.rows().begin(); j != r.rows().end(); ++j) {
+                      for (int i = r.cols().begin(); i != r.cols().end();
+                           ++i) {
+                        call(loop_body,
+                             camp::num<ICount>{},
+                             *(segment0.begin() + i),
+                             *(segment1.begin() + j),
+                             *(segment2.begin() + k),
+                             i,
+                             j,
+                             k);
+                      }
+                    }
+                  }
+                });
+  }
+
+private:
+  template <typename BODY, typename IDX>
+  static RAJA_INLINE void call(BODY &body, camp::num<false>, IDX idx, int)
+  {
+    body(idx);
+  }
+
+  template <typename BODY, typename IDX>
+  static RAJA_INLINE void call(BODY &body, camp::num<true>, IDX idx, int i)
+  {
+    body(idx, i);
+  }
+
+  template <typename BODY, typename IDX>
+  static RAJA_INLINE void call(
+      BODY &body, camp::num<false>, IDX idx0, IDX idx1, int, int)
+  {
+    body(idx0, idx1);
+  }
+
+  template <typename BODY, typename IDX>
+  static RAJA_INLINE void call(
+      BODY &body, camp::num<true>, IDX idx0, IDX idx1, int i, int j)
+  {
+    body(idx0, idx1, i, j);
+  }
+
+  template <typename BODY, typename IDX>
+  static RAJA_INLINE void call(
+      BODY &body, camp::num<false>, IDX idx0, IDX idx1, IDX idx2, int, int, int)
+  {
+    body(idx0, idx1, idx2);
+  }
+
+  template <typename BODY, typename IDX>
+  static RAJA_INLINE void call(BODY &body,
+                               camp::num<true>,
+                               IDX idx0,
+                               IDX idx1,
+                               IDX idx2,
+                               int i,
+                               int j,
+                               int k)
+  {
+    body(idx0, idx1, idx2, i, j, k);
+  }
+};
+
+//! tile and tile_icount for the TBB loop policies, grain sizes as above
+template <typename POLICY, typename SEGMENT, bool ICount>
+struct TBBTileExecute {
+
+  using runner = RAJA::policy::tbb::internal::parallel_for_runner<POLICY>;
+
+  template <typename TILE_T, typename BODY>
+  static RAJA_INLINE void exec(LaunchContext const RAJA_UNUSED_ARG(&ctx),
+                               TILE_T tile_size,
+                               SEGMENT const &segment,
+                               BODY const &body)
+  {
+    using brange = ::tbb::blocked_range<int>;
+
+    const int len = segment.end() - segment.begin();
+    const int num_tiles = RAJA_DIVIDE_CEILING_INT(len, tile_size);
+
+    runner::run(brange(0, num_tiles, runner::grain_size),
+                [&](const brange &r) {
+                  using RAJA::internal::thread_privatize;
+                  auto privatizer = thread_privatize(body);
+                  auto &loop_body = privatizer.get_priv();
+                  for (int bx = r.begin(); bx != r.end(); ++bx) {
+                    call(loop_body,
+                         camp::num<ICount>{},
+                         segment.slice(bx * tile_size, tile_size),
+                         bx);
+                  }
+                });
+  }
+
+private:
+  template <typename BODY, typename TILE>
+  static RAJA_INLINE void call(BODY &body, camp::num<false>, TILE tile, int)
+  {
+    body(tile);
+  }
+
+  template <typename BODY, typename TILE>
+  static RAJA_INLINE void call(BODY &body, camp::num<true>, TILE tile, int bx)
+  {
+    body(tile, bx);
+  }
+};
+
+}  // namespace detail
+
+template <typename SEGMENT>
+struct LoopExecute<tbb_for_dynamic, SEGMENT>
+    : detail::TBBLoopExecute<tbb_for_dynamic, SEGMENT, false> {
+};
+
+template <std::size_t GrainSize, typename SEGMENT>
+struct LoopExecute<tbb_for_static<GrainSize>, SEGMENT>
+    : detail::TBBLoopExecute<tbb_for_static<GrainSize>, SEGMENT, false> {
+};
+
+template <std::size_t GrainSize, typename SEGMENT>
+struct LoopExecute<tbb_for_affinity<GrainSize>, SEGMENT>
+    : detail::TBBLoopExecute<tbb_for_affinity<GrainSize>, SEGMENT, false> {
+};
+
+//
+// Return local index
+//
+template <typename SEGMENT>
+struct LoopICountExecute<tbb_for_dynamic, SEGMENT>
+    : detail::TBBLoopExecute<tbb_for_dynamic, SEGMENT, true> {
+};
+
+template <std::size_t GrainSize, typename SEGMENT>
+struct LoopICountExecute<tbb_for_static<GrainSize>, SEGMENT>
+    : detail::TBBLoopExecute<tbb_for_static<GrainSize>, SEGMENT, true> {
+};
+
+template <std::size_t GrainSize, typename SEGMENT>
+struct LoopICountExecute<tbb_for_affinity<GrainSize>, SEGMENT>
+    : detail::TBBLoopExecute<tbb_for_affinity<GrainSize>, SEGMENT, true> {
+};
+
+//Tile Execute + variants
+
+template <typename SEGMENT>
+struct TileExecute<tbb_for_dynamic, SEGMENT>
+    : detail::TBBTileExecute<tbb_for_dynamic, SEGMENT, false> {
+};
+
+template <std::size_t GrainSize, typename SEGMENT>
+struct TileExecute<tbb_for_static<GrainSize>, SEGMENT>
+    : detail::TBBTileExecute<tbb_for_static<GrainSize>, SEGMENT, false> {
+};
+
+template <std::size_t GrainSize, typename SEGMENT>
+struct TileExecute<tbb_for_affinity<GrainSize>, SEGMENT>
+    : detail::TBBTileExecute<tbb_for_affinity<GrainSize>, SEGMENT, false> {
+};
+
+template <typename SEGMENT>
+struct TileICountExecute<tbb_for_dynamic, SEGMENT>
+    : detail::TBBTileExecute<tbb_for_dynamic, SEGMENT, true> {
+};
+
+template <std::size_t GrainSize, typename SEGMENT>
+struct TileICountExecute<tbb_for_static<GrainSize>, SEGMENT>
+    : detail::TBBTileExecute<tbb_for_static<GrainSize>, SEGMENT, true> {
+};
+
+template <std::size_t GrainSize, typename SEGMENT>
+struct TileICountExecute<tbb_for_affinity<GrainSize>, SEGMENT>
+    : detail::TBBTileExecute<tbb_for_affinity<GrainSize>, SEGMENT, true> {
+};
+
+}  // namespace expt
+
+}  // namespace RAJA
+
+#endif  // closing endif for RAJA_ENABLE_TBB guard
+
+#endif  // closing endif for header file include guard
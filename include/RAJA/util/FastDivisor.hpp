@@ -0,0 +1,161 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   Header file for integer division by a run-time invariant divisor
+ *          using a precomputed multiply-shift reciprocal.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_FASTDIVISOR_HPP
+#define RAJA_FASTDIVISOR_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+#include "RAJA/util/macros.hpp"
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+//! High half of the full product of two 32-bit unsigned integers
+RAJA_INLINE RAJA_HOST_DEVICE uint32_t mulhi(uint32_t a, uint32_t b)
+{
+#if defined(RAJA_DEVICE_CODE)
+  return __umulhi(a, b);
+#else
+  return static_cast<uint32_t>((static_cast<uint64_t>(a) * b) >> 32);
+#endif
+}
+
+//! High half of the full product of two 64-bit unsigned integers
+RAJA_INLINE RAJA_HOST_DEVICE uint64_t mulhi(uint64_t a, uint64_t b)
+{
+#if defined(RAJA_DEVICE_CODE)
+  return __umul64hi(a, b);
+#elif defined(__SIZEOF_INT128__)
+  return static_cast<uint64_t>((static_cast<unsigned __int128>(a) * b) >> 64);
+#else
+  const uint64_t a_lo = a & 0xffffffffu, a_hi = a >> 32;
+  const uint64_t b_lo = b & 0xffffffffu, b_hi = b >> 32;
+  const uint64_t lo_lo = a_lo * b_lo;
+  const uint64_t hi_lo = a_hi * b_lo;
+  const uint64_t lo_hi = a_lo * b_hi;
+  const uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xffffffffu) + lo_hi;
+  return a_hi * b_hi + (hi_lo >> 32) + (cross >> 32);
+#endif
+}
+
+}  // namespace detail
+
+/*!
+ * @brief Divides non-negative integers by a fixed positive divisor using
+ *        only a multiply, a subtract, an add and shifts.
+ *
+ * The reciprocal is computed once when the FastDivisor is constructed
+ * (Granlund and Montgomery, "Division by Invariant Integers using
+ * Multiplication", 1994), so it pays off when the same divisor is used many
+ * times, for example the strides and sizes of a Layout. Division is exact
+ * for every numerator in [0, max of T], on host and device.
+ *
+ * For example:
+ *
+ *     RAJA::FastDivisor<int> by7(7);
+ *     int q = by7.div(100);  // q = 14
+ *     int r = by7.mod(100);  // r = 2
+ *
+ * A default-constructed FastDivisor divides by 1.
+ */
+template <typename T>
+struct FastDivisor {
+  static_assert(std::is_integral<T>::value,
+                "FastDivisor requires an integral type");
+
+  //! unsigned type the division is carried out in
+  using unsigned_type = typename std::
+      conditional<(sizeof(T) <= sizeof(uint32_t)), uint32_t, uint64_t>::type;
+
+  static constexpr int num_bits = 8 * sizeof(unsigned_type);
+
+  T divisor{1};
+  unsigned_type multiplier{1};
+  int shift1{0};
+  int shift2{0};
+
+  constexpr RAJA_INLINE FastDivisor() = default;
+
+  /*!
+   * Precompute the reciprocal of d, which must be positive.
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr FastDivisor(T d)
+      : divisor(d), multiplier(1), shift1(0), shift2(0)
+  {
+    const unsigned_type ud = static_cast<unsigned_type>(d);
+
+    // l = ceil(log2(d))
+    int l = 0;
+    while (l < num_bits && (unsigned_type(1) << l) < ud) {
+      ++l;
+    }
+
+    // multiplier = floor(2^N * (2^l - d) / d) + 1, by long division of the
+    // remainder (2^l - d) < d
+    unsigned_type rem = (l == num_bits) ? unsigned_type(0) - ud
+                                        : (unsigned_type(1) << l) - ud;
+    unsigned_type quot = 0;
+    for (int i = 0; i < num_bits; ++i) {
+      const bool carry = (rem >> (num_bits - 1)) != 0;
+      rem = static_cast<unsigned_type>(rem << 1);
+      quot = static_cast<unsigned_type>(quot << 1);
+      if (carry || rem >= ud) {
+        rem = static_cast<unsigned_type>(rem - ud);
+        quot |= 1;
+      }
+    }
+    multiplier = static_cast<unsigned_type>(quot + 1);
+    shift1 = l < 1 ? l : 1;
+    shift2 = l > 1 ? l - 1 : 0;
+  }
+
+  //! n / divisor, for n >= 0
+  RAJA_INLINE RAJA_HOST_DEVICE T div(T n) const
+  {
+    const unsigned_type un = static_cast<unsigned_type>(n);
+    const unsigned_type t = detail::mulhi(multiplier, un);
+    return static_cast<T>((t + ((un - t) >> shift1)) >> shift2);
+  }
+
+  //! n % divisor, for n >= 0
+  RAJA_INLINE RAJA_HOST_DEVICE T mod(T n) const
+  {
+    return static_cast<T>(n - div(n) * divisor);
+  }
+
+  //! Set q = n / divisor and r = n % divisor, for n >= 0
+  RAJA_INLINE RAJA_HOST_DEVICE void divmod(T n, T &q, T &r) const
+  {
+    q = div(n);
+    r = static_cast<T>(n - q * divisor);
+  }
+};
+
+template <typename T>
+constexpr int FastDivisor<T>::num_bits;
+
+}  // namespace RAJA
+
+#endif
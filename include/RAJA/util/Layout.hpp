@@ -28,6 +28,7 @@
 
 #include "RAJA/internal/foldl.hpp"
 
+#include "RAJA/util/FastDivisor.hpp"
 #include "RAJA/util/Operators.hpp"
 #include "RAJA/util/Permutations.hpp"
 
@@ -249,6 +250,106 @@ constexpr size_t
 template <camp::idx_t... RangeInts, typename IdxLin, ptrdiff_t StrideOneDim>
 constexpr IdxLin
     LayoutBase_impl<camp::idx_seq<RangeInts...>, IdxLin, StrideOneDim>::limit;
+
+
+template <typename Range,
+          typename IdxLin = Index_type,
+          ptrdiff_t StrideOneDim = -1>
+struct FastDivLayoutBase_impl;
+
+/*!
+ * A LayoutBase_impl that also stores a FastDivisor for each stride and
+ * size, so toIndices uses multiplies and shifts instead of divides.
+ */
+template <camp::idx_t... RangeInts, typename IdxLin, ptrdiff_t StrideOneDim>
+struct FastDivLayoutBase_impl<camp::idx_seq<RangeInts...>, IdxLin, StrideOneDim>
+    : public LayoutBase_impl<camp::idx_seq<RangeInts...>, IdxLin, StrideOneDim> {
+public:
+  using Base =
+      LayoutBase_impl<camp::idx_seq<RangeInts...>, IdxLin, StrideOneDim>;
+
+  using Base::n_dims;
+
+  FastDivisor<IdxLin> div_strides[n_dims];
+  FastDivisor<IdxLin> div_mods[n_dims];
+
+
+  constexpr RAJA_INLINE FastDivLayoutBase_impl() = default;
+  constexpr RAJA_INLINE FastDivLayoutBase_impl(FastDivLayoutBase_impl const &) =
+      default;
+  constexpr RAJA_INLINE FastDivLayoutBase_impl(FastDivLayoutBase_impl &&) =
+      default;
+  RAJA_INLINE FastDivLayoutBase_impl &operator=(
+      FastDivLayoutBase_impl const &) = default;
+  RAJA_INLINE FastDivLayoutBase_impl &operator=(FastDivLayoutBase_impl &&) =
+      default;
+
+  /*!
+   * Construct a layout given the size of each dimension.
+   */
+  template <typename... Types>
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr FastDivLayoutBase_impl(Types... ns)
+      : Base(ns...),
+        div_strides{FastDivisor<IdxLin>(this->inv_strides[RangeInts])...},
+        div_mods{FastDivisor<IdxLin>(this->inv_mods[RangeInts])...}
+  {
+  }
+
+  /*!
+   *  Construct from a layout, such as one made by make_permuted_layout.
+   */
+  template <typename CIdxLin, ptrdiff_t CStrideOneDim>
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr FastDivLayoutBase_impl(
+      const LayoutBase_impl<camp::idx_seq<RangeInts...>, CIdxLin, CStrideOneDim>
+          &rhs)
+      : Base(rhs),
+        div_strides{FastDivisor<IdxLin>(this->inv_strides[RangeInts])...},
+        div_mods{FastDivisor<IdxLin>(this->inv_mods[RangeInts])...}
+  {
+  }
+
+  /*!
+   *  Construct a Layout given the size and stride of each dimension
+   */
+  RAJA_INLINE constexpr FastDivLayoutBase_impl(
+      const std::array<IdxLin, n_dims> &sizes_in,
+      const std::array<IdxLin, n_dims> &strides_in)
+      : Base(sizes_in, strides_in),
+        div_strides{FastDivisor<IdxLin>(this->inv_strides[RangeInts])...},
+        div_mods{FastDivisor<IdxLin>(this->inv_mods[RangeInts])...}
+  {
+  }
+
+  /*!
+   * Given a linear-space index, compute the n-dimensional indices defined
+   * by this layout.
+   *
+   * Same as LayoutBase_impl::toIndices, with each divide replaced by a
+   * multiply and shifts.
+   *
+   * @param linear_index  Linear space index to be converted to indices.
+   * @param indices  Variadic list of indices to be assigned, number must match
+   *                 dimensionality of this layout.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE void toIndices(IdxLin linear_index,
+                                              Indices &&... indices) const
+  {
+#if defined(RAJA_BOUNDS_CHECK_INTERNAL)
+    IdxLin totSize{1};
+    for(size_t i=0; i<n_dims; ++i) {totSize *= this->sizes[i];};
+    if(totSize > 0 && (linear_index < 0 || linear_index >= totSize)) {
+      printf("Error! Linear index %ld is not within bounds [0, %ld]. \n",
+             static_cast<long int>(linear_index), static_cast<long int>(totSize-1));
+      RAJA_ABORT_OR_THROW("Out of bounds error \n");
+     }
+#endif
+
+    camp::sink((indices = (camp::decay<Indices>)(div_mods[RangeInts].mod(
+                    div_strides[RangeInts].div(linear_index))))...);
+  }
+};
+
 }  // namespace detail
 
 /*!
@@ -372,6 +473,91 @@ private:
 };
 
 
+/*!
+ * @brief A Layout whose toIndices uses precomputed multiply-shift
+ *        reciprocals of its strides and sizes instead of integer divides.
+ *
+ * Indexing with operator() is the same as Layout. Building the layout costs
+ * a little more, so it is meant for layouts that are built once and used
+ * to convert many linear indices, for example in flattened loops:
+ *
+ *     RAJA::FastDivLayout<3> layout(5, 7, 11);
+ *
+ *     int i, j, k;
+ *     layout.toIndices(188, i, j, k); // i,j,k = {2, 3, 1}
+ *
+ * A FastDivLayout can also be constructed from any Layout of the same
+ * rank, such as one made by make_permuted_layout.
+ */
+template <size_t n_dims, typename IdxLin = Index_type, ptrdiff_t StrideOne = -1>
+using FastDivLayout =
+    detail::FastDivLayoutBase_impl<camp::make_idx_seq_t<n_dims>,
+                                   IdxLin,
+                                   StrideOne>;
+
+template <typename IdxLin, typename DimTuple, ptrdiff_t StrideOne = -1>
+struct TypedFastDivLayout;
+
+/*!
+ * @brief TypedLayout counterpart of FastDivLayout.
+ */
+template <typename IdxLin, typename... DimTypes, ptrdiff_t StrideOne>
+struct TypedFastDivLayout<IdxLin, camp::tuple<DimTypes...>, StrideOne>
+    : public FastDivLayout<sizeof...(DimTypes),
+                           strip_index_type_t<IdxLin>,
+                           StrideOne> {
+
+  using StrippedIdxLin = strip_index_type_t<IdxLin>;
+  using Self = TypedFastDivLayout<IdxLin, camp::tuple<DimTypes...>, StrideOne>;
+  using Base = FastDivLayout<sizeof...(DimTypes), StrippedIdxLin, StrideOne>;
+  using DimArr = std::array<StrippedIdxLin, sizeof...(DimTypes)>;
+
+  // Pull in base constructors
+  using Base::Base;
+
+
+  /*!
+   * Computes a linear space index from specified indices.
+   *
+   * @param indices  Indices in the n-dimensional space of this layout
+   * @return Linear space index.
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE constexpr IdxLin operator()(
+      DimTypes... indices) const
+  {
+    return IdxLin(Base::operator()(stripIndexType(indices)...));
+  }
+
+
+  /*!
+   * Given a linear-space index, compute the n-dimensional indices defined
+   * by this layout, using multiplies and shifts instead of divides.
+   *
+   * @param linear_index  Linear space index to be converted to indices.
+   * @param indices  Variadic list of indices to be assigned, number must match
+   *                 dimensionality of this layout.
+   */
+  RAJA_INLINE RAJA_HOST_DEVICE void toIndices(IdxLin linear_index,
+                                              DimTypes &... indices) const
+  {
+    toIndicesHelper(camp::make_idx_seq_t<sizeof...(DimTypes)>{},
+                    std::forward<IdxLin>(linear_index),
+                    std::forward<DimTypes &>(indices)...);
+  }
+
+private:
+  template <typename... Indices, camp::idx_t... RangeInts>
+  RAJA_INLINE RAJA_HOST_DEVICE void toIndicesHelper(camp::idx_seq<RangeInts...>,
+                                                    IdxLin linear_index,
+                                                    Indices &... indices) const
+  {
+    Index_type locals[sizeof...(DimTypes)];
+    Base::toIndices(stripIndexType(linear_index), locals[RangeInts]...);
+    camp::sink((indices = Indices{static_cast<Indices>(locals[RangeInts])})...);
+  }
+};
+
+
 /*!
  * Convert a non-stride-one Layout to a stride-1 Layout
  *
@@ -37,15 +37,18 @@ namespace RAJA
 namespace internal
 {
 
-template <typename Range, typename IdxLin>
+template <typename Range,
+          typename IdxLin,
+          typename LayoutBase = RAJA::detail::LayoutBase_impl<Range, IdxLin>>
 struct OffsetLayout_impl;
 
-template <camp::idx_t... RangeInts, typename IdxLin>
-struct OffsetLayout_impl<camp::idx_seq<RangeInts...>, IdxLin> {
-  using Self = OffsetLayout_impl<camp::idx_seq<RangeInts...>, IdxLin>;
+template <camp::idx_t... RangeInts, typename IdxLin, typename LayoutBase>
+struct OffsetLayout_impl<camp::idx_seq<RangeInts...>, IdxLin, LayoutBase> {
+  using Self =
+      OffsetLayout_impl<camp::idx_seq<RangeInts...>, IdxLin, LayoutBase>;
   using IndexRange = camp::idx_seq<RangeInts...>;
   using IndexLinear = IdxLin;
-  using Base = RAJA::detail::LayoutBase_impl<IndexRange, IdxLin>;
+  using Base = LayoutBase;
   Base base_;
 
   static constexpr camp::idx_t stride_one_dim = Base::stride_one_dim;
@@ -66,6 +69,14 @@ struct OffsetLayout_impl<camp::idx_seq<RangeInts...>, IdxLin> {
   {
   }
 
+  //! Convert from an OffsetLayout_impl with a different base layout
+  template <typename OtherBase>
+  constexpr RAJA_INLINE RAJA_HOST_DEVICE OffsetLayout_impl(
+      OffsetLayout_impl<IndexRange, IdxLin, OtherBase> const& c)
+      : base_(c.base_), offsets{c.offsets[RangeInts]...}
+  {
+  }
+
   void shift(std::array<IdxLin, sizeof...(RangeInts)> shift)
   {
     for(size_t i=0; i<n_dims; ++i) offsets[i] += shift[i];
@@ -106,7 +117,24 @@ struct OffsetLayout_impl<camp::idx_seq<RangeInts...>, IdxLin> {
     return base_((indices - offsets[RangeInts])...);
   }
 
-  static RAJA_INLINE OffsetLayout_impl<IndexRange, IdxLin>
+  /*!
+   * Given a linear-space index, compute the n-dimensional indices defined
+   * by this layout, including the offsets.
+   *
+   * @param linear_index  Linear space index to be converted to indices.
+   * @param indices  Variadic list of indices to be assigned, number must match
+   *                 dimensionality of this layout.
+   */
+  template <typename... Indices>
+  RAJA_INLINE RAJA_HOST_DEVICE void toIndices(IdxLin linear_index,
+                                              Indices&&... indices) const
+  {
+    base_.toIndices(linear_index, indices...);
+    camp::sink((indices += static_cast<camp::decay<Indices>>(
+                    offsets[RangeInts]))...);
+  }
+
+  static RAJA_INLINE Self
   from_layout_and_offsets(
       const std::array<IdxLin, sizeof...(RangeInts)>& offsets_in,
       const Layout<sizeof...(RangeInts), IdxLin>& rhs)
@@ -201,6 +229,34 @@ auto make_permuted_offset_layout(const std::array<IdxLin, Rank>& lower,
       from_layout_and_offsets(lower, make_permuted_layout(sizes, permutation));
 }
 
+/*!
+ * @brief An OffsetLayout whose toIndices uses the multiply-shift division
+ *        of FastDivLayout.
+ *
+ * Can be constructed from the same arguments as an OffsetLayout, or from
+ * an OffsetLayout, such as one made by make_permuted_offset_layout.
+ */
+template <size_t n_dims = 1, typename IdxLin = Index_type>
+struct FastDivOffsetLayout
+    : public internal::OffsetLayout_impl<
+          camp::make_idx_seq_t<n_dims>,
+          IdxLin,
+          RAJA::detail::FastDivLayoutBase_impl<camp::make_idx_seq_t<n_dims>,
+                                               IdxLin>> {
+  using Base = internal::OffsetLayout_impl<
+      camp::make_idx_seq_t<n_dims>,
+      IdxLin,
+      RAJA::detail::FastDivLayoutBase_impl<camp::make_idx_seq_t<n_dims>,
+                                           IdxLin>>;
+
+  using Base::Base;
+
+  constexpr RAJA_INLINE RAJA_HOST_DEVICE FastDivOffsetLayout(Base const& rhs)
+      : Base{rhs}
+  {
+  }
+};
+
 }  // namespace RAJA
 
 #endif
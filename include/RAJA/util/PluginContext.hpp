@@ -8,10 +8,54 @@
 #ifndef RAJA_plugin_context_HPP
 #define RAJA_plugin_context_HPP
 
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <typeinfo>
+
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
 #include "RAJA/policy/PolicyBase.hpp"
 #include "RAJA/internal/get_platform.hpp"
 
 namespace RAJA {
+
+namespace detail {
+
+//! Readable form of a std::type_info::name(), where the ABI can demangle it
+inline std::string demangle_type_name(const char* name)
+{
+#if defined(__GNUG__)
+  int status = 0;
+  char* demangled = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+  if (status == 0 && demangled) {
+    std::string result(demangled);
+    std::free(demangled);
+    return result;
+  }
+#endif
+  return name;
+}
+
+//! Type name of T, demangled once and kept for the rest of the run
+template <typename T>
+const char* type_name()
+{
+#if defined(__GXX_RTTI) || defined(_CPPRTTI) || defined(__cpp_rtti)
+  static const std::string name = demangle_type_name(typeid(T).name());
+  return name.c_str();
+#elif defined(__GNUC__)
+  return __PRETTY_FUNCTION__;
+#else
+  return "";
+#endif
+}
+
+} // closing brace for detail namespace
+
 namespace util {
 
 class KokkosPluginLoader;
@@ -23,6 +67,31 @@ struct PluginContext {
 
     Platform platform;
 
+    //! RAJA pattern that made the context: forall, kernel, scan, sort,
+    //! workgroup or launch
+    Pattern pattern{Pattern::undefined};
+
+    //! Name given to the kernel by the user, or nullptr
+    const char* kernel_name{nullptr};
+
+    //! Stable kernel identifier: kernel_name if given, otherwise the
+    //! type name of the loop body
+    const char* kernel_id{nullptr};
+
+    //! Type name of the execution policy
+    //!
+    //! Type names are demangled where the C++ ABI supports it, otherwise
+    //! they are the implementation-defined std::type_info::name()
+    const char* policy_name{nullptr};
+
+    //! Number of iterations in the iteration space, 0 if unknown
+    std::size_t num_iterations{0};
+
+    //! False if no plugins were registered when the context was made, in
+    //! which case the metadata above is not filled in and the plugin calls
+    //! return immediately
+    bool has_plugins{true};
+
   private:
     mutable uint64_t kID;
 
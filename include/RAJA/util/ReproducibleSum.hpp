@@ -0,0 +1,292 @@
+/*!
+ ******************************************************************************
+ *
+ * \file
+ *
+ * \brief   RAJA header file defining an accumulator whose floating point
+ *          sums do not depend on the order of the additions.
+ *
+ ******************************************************************************
+ */
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJA_util_ReproducibleSum_HPP
+#define RAJA_util_ReproducibleSum_HPP
+
+#include "RAJA/config.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace RAJA
+{
+
+namespace detail
+{
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Sum accumulator for integral types, integer addition is already
+ *         independent of the order of the additions.
+ *
+ ******************************************************************************
+ */
+template <typename T, bool = std::is_floating_point<T>::value>
+class ReproducibleSumAccumulator
+{
+  static_assert(std::is_integral<T>::value,
+                "ReproducibleSumAccumulator requires an arithmetic type");
+
+public:
+  ReproducibleSumAccumulator() : m_value(0) {}
+
+  explicit ReproducibleSumAccumulator(T val) : m_value(val) {}
+
+  void add(T val) { m_value += val; }
+
+  void merge(ReproducibleSumAccumulator const& other)
+  {
+    m_value += other.m_value;
+  }
+
+  T value() const { return m_value; }
+
+  bool operator==(ReproducibleSumAccumulator const& other) const
+  {
+    return m_value == other.m_value;
+  }
+
+  bool operator!=(ReproducibleSumAccumulator const& other) const
+  {
+    return m_value != other.m_value;
+  }
+
+private:
+  T m_value;
+};
+
+/*!
+ ******************************************************************************
+ *
+ * \brief  Exact sum accumulator for float and double.
+ *
+ *         Every finite double is a multiple of 2^-1074 below 2^1024, so
+ *         sums are accumulated exactly in a fixed point number covering
+ *         that range, split into 32 bit limbs held in 64 bit integers.
+ *         Each addition touches at most three limbs and carries are only
+ *         propagated every max_deferred_adds additions or when the value
+ *         is read. The sum is exact, so the result is the same for any
+ *         order of additions or merges and is rounded once when read.
+ *
+ *         Infinities and NaNs are summed separately with normal floating
+ *         point addition, which is order independent for those values.
+ *
+ ******************************************************************************
+ */
+template <typename T>
+class ReproducibleSumAccumulator<T, true>
+{
+  static_assert(std::numeric_limits<T>::radix == 2 &&
+                    std::numeric_limits<T>::digits <=
+                        std::numeric_limits<double>::digits &&
+                    std::numeric_limits<double>::digits == 53,
+                "ReproducibleSumAccumulator supports float and double");
+
+  static constexpr int limb_bits = 32;
+  static constexpr std::int64_t limb_mask = (std::int64_t(1) << limb_bits) - 1;
+  //! bits 2^-1074 to 2^1024 plus room for the carries of 2^64 additions
+  static constexpr int num_limbs = 68;
+  //! each addition adds less than 2^33 to a limb
+  static constexpr int max_deferred_adds = 1 << 28;
+
+public:
+  ReproducibleSumAccumulator() : m_limbs{}, m_deferred_adds(0), m_special(0.0)
+  {
+  }
+
+  explicit ReproducibleSumAccumulator(T val)
+      : m_limbs{}, m_deferred_adds(0), m_special(0.0)
+  {
+    add(val);
+  }
+
+  void add(T val)
+  {
+    const double dval = static_cast<double>(val);
+    std::uint64_t bits;
+    std::memcpy(&bits, &dval, sizeof(bits));
+
+    int exponent = static_cast<int>((bits >> 52) & 0x7ff);
+    std::uint64_t mantissa = bits & ((std::uint64_t(1) << 52) - 1);
+
+    if (exponent == 0x7ff) {
+      m_special += dval;
+      return;
+    }
+    if (exponent == 0) {
+      // subnormals share the scale of the smallest normal exponent
+      exponent = 1;
+    } else {
+      mantissa |= std::uint64_t(1) << 52;
+    }
+
+    // mantissa * 2^(exponent - 1075) as bits starting at 2^-1074
+    const int offset = exponent - 1;
+    const int limb = offset / limb_bits;
+    const int shift = offset % limb_bits;
+
+    const std::uint64_t lo = (mantissa & limb_mask) << shift;
+    const std::uint64_t hi = (mantissa >> limb_bits) << shift;
+
+    const std::int64_t l0 = static_cast<std::int64_t>(lo & limb_mask);
+    const std::int64_t l1 =
+        static_cast<std::int64_t>((lo >> limb_bits) + (hi & limb_mask));
+    const std::int64_t l2 = static_cast<std::int64_t>(hi >> limb_bits);
+
+    // negate without a branch when the sign bit is set
+    const std::int64_t sign = -static_cast<std::int64_t>(bits >> 63);
+    m_limbs[limb] += (l0 ^ sign) - sign;
+    m_limbs[limb + 1] += (l1 ^ sign) - sign;
+    m_limbs[limb + 2] += (l2 ^ sign) - sign;
+
+    if (++m_deferred_adds == max_deferred_adds) {
+      normalize();
+    }
+  }
+
+  void merge(ReproducibleSumAccumulator const& other)
+  {
+    if (m_deferred_adds + other.m_deferred_adds >= max_deferred_adds) {
+      normalize();
+    }
+    if (other.m_deferred_adds >= max_deferred_adds) {
+      ReproducibleSumAccumulator tmp(other);
+      tmp.normalize();
+      merge_limbs(tmp);
+    } else {
+      merge_limbs(other);
+    }
+    m_special += other.m_special;
+  }
+
+  //! the sum rounded to nearest, subnormal results may be rounded twice
+  T value() const
+  {
+    if (m_special != 0.0) {
+      return static_cast<T>(m_special);
+    }
+
+    ReproducibleSumAccumulator tmp(*this);
+    tmp.normalize();
+
+    bool negative = tmp.m_limbs[num_limbs - 1] < 0;
+    if (negative) {
+      tmp.negate();
+    }
+
+    int top = num_limbs - 1;
+    while (top >= 0 && tmp.m_limbs[top] == 0) {
+      --top;
+    }
+    if (top < 0) {
+      return T(0);
+    }
+
+    // leading 96 bits of the magnitude and whether any bits below are set
+    const std::uint64_t hi = static_cast<std::uint64_t>(tmp.m_limbs[top]);
+    const std::uint64_t mid =
+        (top >= 1) ? static_cast<std::uint64_t>(tmp.m_limbs[top - 1]) : 0;
+    const std::uint64_t lo =
+        (top >= 2) ? static_cast<std::uint64_t>(tmp.m_limbs[top - 2]) : 0;
+    bool sticky = false;
+    for (int i = top - 3; i >= 0 && !sticky; --i) {
+      sticky = tmp.m_limbs[i] != 0;
+    }
+
+    int lead = 0;
+    while ((hi << lead) < (std::uint64_t(1) << (limb_bits - 1))) {
+      ++lead;
+    }
+
+    // leading 64 bits with the remaining bits folded into the last bit so
+    // the conversion to T rounds correctly, for float as well as double
+    std::uint64_t leading = (hi << (limb_bits + lead)) | (mid << lead);
+    if (lead > 0) {
+      leading |= lo >> (limb_bits - lead);
+    }
+    sticky = sticky || (lo << (limb_bits + lead)) != 0;
+    if (sticky) {
+      leading |= 1;
+    }
+
+    T result = std::ldexp(static_cast<T>(leading),
+                          limb_bits * (top - 1) - 1074 - lead);
+    return negative ? -result : result;
+  }
+
+  //! true if both hold the same limbs, equal sums may compare unequal
+  bool operator==(ReproducibleSumAccumulator const& other) const
+  {
+    for (int i = 0; i < num_limbs; ++i) {
+      if (m_limbs[i] != other.m_limbs[i]) {
+        return false;
+      }
+    }
+    return m_special == other.m_special ||
+           (m_special != m_special && other.m_special != other.m_special);
+  }
+
+  bool operator!=(ReproducibleSumAccumulator const& other) const
+  {
+    return !(*this == other);
+  }
+
+private:
+  void merge_limbs(ReproducibleSumAccumulator const& other)
+  {
+    for (int i = 0; i < num_limbs; ++i) {
+      m_limbs[i] += other.m_limbs[i];
+    }
+    m_deferred_adds += other.m_deferred_adds;
+  }
+
+  //! propagate carries so all limbs but the last are in [0, 2^32)
+  void normalize()
+  {
+    for (int i = 0; i < num_limbs - 1; ++i) {
+      const std::int64_t carry = m_limbs[i] >> limb_bits;
+      m_limbs[i] &= limb_mask;
+      m_limbs[i + 1] += carry;
+    }
+    m_deferred_adds = 0;
+  }
+
+  //! negate a normalized value and normalize it again
+  void negate()
+  {
+    for (int i = 0; i < num_limbs; ++i) {
+      m_limbs[i] = -m_limbs[i];
+    }
+    normalize();
+  }
+
+  std::int64_t m_limbs[num_limbs];
+  int m_deferred_adds;
+  double m_special;
+};
+
+}  // namespace detail
+
+}  // namespace RAJA
+
+#endif  // closing endif for header file include guard
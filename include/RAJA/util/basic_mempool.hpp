@@ -18,12 +18,22 @@
 #ifndef RAJA_BASIC_MEMPOOL_HPP
 #define RAJA_BASIC_MEMPOOL_HPP
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
+#include <functional>
 #include <list>
 #include <map>
+#include <memory>
+#include <vector>
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#endif
 
 #include "RAJA/util/align.hpp"
 #include "RAJA/util/mutex.hpp"
@@ -41,34 +51,46 @@ namespace detail
 /*! \class MemoryArena
  ******************************************************************************
  *
- * \brief  MemoryArena is a map based subclass for class MemPool
+ * \brief  MemoryArena is a two level segregated fit subclass for class MemPool
  * provides book-keeping to divy a large chunk of pre-allocated memory to avoid
  * the overhead of  malloc/free or cudaMalloc/cudaFree, etc
  *
  * get/give are the primary calls used by class MemPool to get aligned memory
  * from the pool or give it back
  *
+ * Chunks are described by entries in a vector on the host, so the arena
+ * memory itself is never touched and may live on a device. Free chunks are
+ * kept in lists by size class, first by power of two and then split into
+ * sl_count linear steps, with a bitmap of the non-empty lists so finding a
+ * large enough chunk takes a few bit operations. Used chunks are found from
+ * their pointer in an open addressing hash table. Neighboring free chunks
+ * are merged when a chunk is given back, so get and give take constant time.
  *
  ******************************************************************************
  */
 class MemoryArena
 {
 public:
-  using free_type = std::map<void*, void*>;
-  using free_value_type = typename free_type::value_type;
-  using used_type = std::map<void*, void*>;
-  using used_value_type = typename used_type::value_type;
-
   MemoryArena(void* ptr, size_t size)
     : m_allocation{ ptr, static_cast<char*>(ptr)+size },
-      m_free_space(),
-      m_used_space()
+      m_fl_bitmap(0),
+      m_sl_bitmap{},
+      m_free_heads{},
+      m_num_used(0)
   {
-     m_free_space[ptr] = static_cast<char*>(ptr)+size ;
     if (m_allocation.begin == nullptr) {
       fprintf(stderr, "Attempt to create MemoryArena with no memory");
       std::abort();
     }
+    for (int fl = 0; fl < fl_count; ++fl) {
+      for (int sl = 0; sl < sl_count; ++sl) {
+        m_free_heads[fl][sl] = null_chunk;
+      }
+    }
+    m_used_table.assign(min_table_size, used_entry{0, null_chunk});
+    if (size > 0) {
+      insert_free_chunk(new_chunk(0, size, null_chunk, null_chunk));
+    }
   }
 
   MemoryArena(MemoryArena const&) = delete;
@@ -83,50 +105,89 @@ public:
            static_cast<char*>(m_allocation.begin);
   }
 
-  bool unused() { return m_used_space.empty(); }
+  bool unused() { return m_num_used == 0; }
 
   void* get_allocation() { return m_allocation.begin; }
 
   void* get(size_t nbytes, size_t alignment)
   {
-    void* ptr_out = nullptr;
-    if (capacity() >= nbytes) {
-      free_type::iterator end = m_free_space.end();
-      for (free_type::iterator iter = m_free_space.begin(); iter != end;
-           ++iter) {
+    if (nbytes == 0) {
+      nbytes = 1;
+    }
+    if (alignment == 0) {
+      alignment = 1;
+    }
+    if (nbytes > capacity() || alignment > capacity()) {
+      return nullptr;
+    }
 
-        void* adj_ptr = iter->first;
-        size_t cap =
-            static_cast<char*>(iter->second) - static_cast<char*>(adj_ptr);
+    // try a chunk from the smallest list whose chunks all hold nbytes, if
+    // its alignment does not work out try again with room to align any
+    // chunk, and finally try the first chunk in the list nbytes maps to
+    chunk_index idx = find_free_chunk(nbytes);
+    if (!chunk_fits(idx, nbytes, alignment) && alignment > 1 &&
+        nbytes <= capacity() - (alignment - 1)) {
+      idx = find_free_chunk(nbytes + (alignment - 1));
+    }
+    if (!chunk_fits(idx, nbytes, alignment)) {
+      int fl, sl;
+      mapping(nbytes, fl, sl);
+      idx = m_free_heads[fl][sl];
+      if (!chunk_fits(idx, nbytes, alignment)) {
+        return nullptr;
+      }
+    }
 
-        if (::RAJA::align(alignment, nbytes, adj_ptr, cap)) {
+    remove_free_chunk(idx);
 
-          ptr_out = adj_ptr;
+    // give the space in front of the aligned pointer back as its own chunk
+    const size_t begin = aligned_offset(idx, alignment);
+    if (begin != m_chunks[idx].offset) {
+      chunk_index front = split_chunk(idx, begin - m_chunks[idx].offset);
+      insert_free_chunk(idx);
+      idx = front;
+    }
 
-          remove_free_chunk(iter,
-                            adj_ptr,
-                            static_cast<char*>(adj_ptr) + nbytes);
+    // give the space after the allocation back as its own chunk
+    if (m_chunks[idx].size != nbytes) {
+      insert_free_chunk(split_chunk(idx, nbytes));
+    }
 
-          add_used_chunk(adj_ptr, static_cast<char*>(adj_ptr) + nbytes);
+    m_chunks[idx].free = false;
+    insert_used_chunk(idx);
+    ++m_num_used;
 
-          break;
-        }
-      }
-    }
-    return ptr_out;
+    return static_cast<char*>(m_allocation.begin) + m_chunks[idx].offset;
   }
 
   bool give(void* ptr)
   {
     if (m_allocation.begin <= ptr && ptr < m_allocation.end) {
 
-      used_type::iterator found = m_used_space.find(ptr);
+      const size_t offset = static_cast<size_t>(
+          static_cast<char*>(ptr) - static_cast<char*>(m_allocation.begin));
+
+      chunk_index idx = remove_used_chunk(offset);
 
-      if (found != m_used_space.end()) {
+      if (idx != null_chunk) {
 
-        add_free_chunk(found->first, found->second);
+        --m_num_used;
+        m_chunks[idx].free = true;
 
-        m_used_space.erase(found);
+        // merge with free neighbors
+        chunk_index prev = m_chunks[idx].phys_prev;
+        if (prev != null_chunk && m_chunks[prev].free) {
+          remove_free_chunk(prev);
+          merge_next_chunk(prev);
+          idx = prev;
+        }
+        chunk_index next = m_chunks[idx].phys_next;
+        if (next != null_chunk && m_chunks[next].free) {
+          remove_free_chunk(next);
+          merge_next_chunk(idx);
+        }
+
+        insert_free_chunk(idx);
 
       } else {
         fprintf(stderr, "Invalid free %p", ptr);
@@ -140,103 +201,432 @@ public:
   }
 
 private:
+  using chunk_index = uint32_t;
+
+  static constexpr chunk_index null_chunk = ~chunk_index(0);
+
+  //! number of linear steps each power of two size range is split into
+  static constexpr int sl_log2 = 4;
+  static constexpr int sl_count = 1 << sl_log2;
+  //! sizes below sl_count have a list each, larger sizes a list per step
+  static constexpr int fl_count = 64 - sl_log2 + 1;
+
+  static constexpr size_t min_table_size = 64;
+
   struct memory_chunk {
     void* begin;
     void* end;
   };
 
-  void add_free_chunk(void* begin, void* end)
+  //! a chunk of the arena, linked to its neighbors in memory and to the
+  //! other chunks in its free list when it is free
+  struct chunk {
+    size_t offset;
+    size_t size;
+    chunk_index phys_prev;
+    chunk_index phys_next;
+    chunk_index free_prev;
+    chunk_index free_next;
+    bool free;
+  };
+
+  struct used_entry {
+    size_t offset;
+    chunk_index index;
+  };
+
+  static int floor_log2(size_t n)
   {
-    // integrates a chunk of memory into free_space
-    free_type::iterator invl = m_free_space.end();
-    free_type::iterator next = m_free_space.lower_bound(begin);
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<int>(sizeof(unsigned long long) * 8 - 1) -
+           __builtin_clzll(static_cast<unsigned long long>(n));
+#else
+    int log = 0;
+    while (n >>= 1) {
+      ++log;
+    }
+    return log;
+#endif
+  }
+
+  static int find_first_set(uint64_t n)
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(static_cast<unsigned long long>(n));
+#else
+    int bit = 0;
+    while ((n & 1) == 0) {
+      n >>= 1;
+      ++bit;
+    }
+    return bit;
+#endif
+  }
+
+  //! free list holding chunks of the given size
+  static void mapping(size_t size, int& fl, int& sl)
+  {
+    if (size < static_cast<size_t>(sl_count)) {
+      fl = 0;
+      sl = static_cast<int>(size);
+    } else {
+      const int log = floor_log2(size);
+      fl = log - sl_log2 + 1;
+      sl = static_cast<int>(size >> (log - sl_log2)) - sl_count;
+    }
+  }
+
+  //! a free chunk of at least size bytes, or null_chunk
+  chunk_index find_free_chunk(size_t size) const
+  {
+    // round up to the next list so any chunk in the list is large enough
+    if (size >= static_cast<size_t>(sl_count)) {
+      const size_t step = size_t(1) << (floor_log2(size) - sl_log2);
+      if (size > ~size_t(0) - (step - 1)) {
+        return null_chunk;
+      }
+      size += step - 1;
+    }
+    int fl, sl;
+    mapping(size, fl, sl);
+
+    uint64_t sl_map = m_sl_bitmap[fl] & (~uint64_t(0) << sl);
+    if (sl_map == 0) {
+      const uint64_t fl_map =
+          (fl + 1 < fl_count) ? m_fl_bitmap & (~uint64_t(0) << (fl + 1)) : 0;
+      if (fl_map == 0) {
+        return null_chunk;
+      }
+      fl = find_first_set(fl_map);
+      sl_map = m_sl_bitmap[fl];
+    }
+    sl = find_first_set(sl_map);
+    return m_free_heads[fl][sl];
+  }
 
-    // check if prev exists
-    if (next != m_free_space.begin()) {
-      // check if prev can cover [begin, end)
-      free_type::iterator prev = next;
-      --prev;
-      if (prev->second == begin) {
-        // extend prev to cover [begin, end)
-        prev->second = end;
+  bool chunk_fits(chunk_index idx, size_t nbytes, size_t alignment) const
+  {
+    return idx != null_chunk &&
+           aligned_offset(idx, alignment) - m_chunks[idx].offset + nbytes <=
+               m_chunks[idx].size;
+  }
 
-        // check if prev can cover next too
-        if (next != invl) {
-          assert(next->first != begin);
+  size_t aligned_offset(chunk_index idx, size_t alignment) const
+  {
+    const uintptr_t begin = reinterpret_cast<uintptr_t>(m_allocation.begin) +
+                            m_chunks[idx].offset;
+    const uintptr_t adjust = (alignment - begin % alignment) % alignment;
+    return m_chunks[idx].offset + adjust;
+  }
 
-          if (next->first == end) {
-            // extend prev to cover next too
-            prev->second = next->second;
+  void insert_free_chunk(chunk_index idx)
+  {
+    chunk& c = m_chunks[idx];
+    int fl, sl;
+    mapping(c.size, fl, sl);
+    c.free = true;
+    c.free_prev = null_chunk;
+    c.free_next = m_free_heads[fl][sl];
+    if (c.free_next != null_chunk) {
+      m_chunks[c.free_next].free_prev = idx;
+    }
+    m_free_heads[fl][sl] = idx;
+    m_fl_bitmap |= uint64_t(1) << fl;
+    m_sl_bitmap[fl] |= uint64_t(1) << sl;
+  }
 
-            // remove redundant next
-            m_free_space.erase(next);
-          }
+  void remove_free_chunk(chunk_index idx)
+  {
+    chunk& c = m_chunks[idx];
+    int fl, sl;
+    mapping(c.size, fl, sl);
+    if (c.free_prev != null_chunk) {
+      m_chunks[c.free_prev].free_next = c.free_next;
+    } else {
+      m_free_heads[fl][sl] = c.free_next;
+      if (c.free_next == null_chunk) {
+        m_sl_bitmap[fl] &= ~(uint64_t(1) << sl);
+        if (m_sl_bitmap[fl] == 0) {
+          m_fl_bitmap &= ~(uint64_t(1) << fl);
         }
-        return;
       }
     }
+    if (c.free_next != null_chunk) {
+      m_chunks[c.free_next].free_prev = c.free_prev;
+    }
+    c.free = false;
+  }
 
-    if (next != invl) {
-      assert(next->first != begin);
+  chunk_index new_chunk(size_t offset,
+                        size_t size,
+                        chunk_index phys_prev,
+                        chunk_index phys_next)
+  {
+    chunk_index idx;
+    if (!m_unused_chunks.empty()) {
+      idx = m_unused_chunks.back();
+      m_unused_chunks.pop_back();
+    } else {
+      idx = static_cast<chunk_index>(m_chunks.size());
+      m_chunks.emplace_back();
+    }
+    m_chunks[idx] = chunk{
+        offset, size, phys_prev, phys_next, null_chunk, null_chunk, false};
+    return idx;
+  }
 
-      if (next->first == end) {
-        // extend next to cover [begin, end)
-        m_free_space.insert(next, free_value_type{begin, next->second});
-        m_free_space.erase(next);
+  //! split idx after size bytes, returns the new chunk holding the rest
+  chunk_index split_chunk(chunk_index idx, size_t size)
+  {
+    const chunk_index rest = new_chunk(m_chunks[idx].offset + size,
+                                       m_chunks[idx].size - size,
+                                       idx,
+                                       m_chunks[idx].phys_next);
+    if (m_chunks[rest].phys_next != null_chunk) {
+      m_chunks[m_chunks[rest].phys_next].phys_prev = rest;
+    }
+    m_chunks[idx].size = size;
+    m_chunks[idx].phys_next = rest;
+    return rest;
+  }
 
-        return;
+  //! absorb the chunk after idx into idx
+  void merge_next_chunk(chunk_index idx)
+  {
+    const chunk_index next = m_chunks[idx].phys_next;
+    m_chunks[idx].size += m_chunks[next].size;
+    m_chunks[idx].phys_next = m_chunks[next].phys_next;
+    if (m_chunks[idx].phys_next != null_chunk) {
+      m_chunks[m_chunks[idx].phys_next].phys_prev = idx;
+    }
+    m_unused_chunks.push_back(next);
+  }
+
+  size_t table_slot(size_t offset) const
+  {
+    const uint64_t hash =
+        static_cast<uint64_t>(offset) * 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(hash >> 32) & (m_used_table.size() - 1);
+  }
+
+  void insert_used_chunk(chunk_index idx)
+  {
+    if (2 * (m_num_used + 1) > m_used_table.size()) {
+      std::vector<used_entry> old(2 * m_used_table.size(),
+                                  used_entry{0, null_chunk});
+      old.swap(m_used_table);
+      for (used_entry const& entry : old) {
+        if (entry.index != null_chunk) {
+          insert_used_entry(entry);
+        }
       }
     }
+    insert_used_entry(used_entry{m_chunks[idx].offset, idx});
+  }
 
-    // no free space adjacent to this chunk, add seperate free chunk [begin,
-    // end)
-    m_free_space.insert(next, free_value_type{begin, end});
+  void insert_used_entry(used_entry entry)
+  {
+    const size_t mask = m_used_table.size() - 1;
+    size_t slot = table_slot(entry.offset);
+    while (m_used_table[slot].index != null_chunk) {
+      slot = (slot + 1) & mask;
+    }
+    m_used_table[slot] = entry;
   }
 
-  void remove_free_chunk(free_type::iterator iter, void* begin, void* end)
+  //! remove the used chunk at offset, returns null_chunk if there is none
+  chunk_index remove_used_chunk(size_t offset)
   {
+    const size_t mask = m_used_table.size() - 1;
+    size_t slot = table_slot(offset);
+    while (m_used_table[slot].index != null_chunk &&
+           m_used_table[slot].offset != offset) {
+      slot = (slot + 1) & mask;
+    }
+    const chunk_index idx = m_used_table[slot].index;
+    if (idx == null_chunk) {
+      return null_chunk;
+    }
 
-    void* ptr = iter->first;
-    void* ptr_end = iter->second;
+    // shift later entries of the probe sequence back into the hole
+    size_t hole = slot;
+    for (size_t next = (hole + 1) & mask;
+         m_used_table[next].index != null_chunk;
+         next = (next + 1) & mask) {
+      const size_t home = table_slot(m_used_table[next].offset);
+      if (((next - home) & mask) >= ((next - hole) & mask)) {
+        m_used_table[hole] = m_used_table[next];
+        hole = next;
+      }
+    }
+    m_used_table[hole] = used_entry{0, null_chunk};
 
-    // fixup m_free_space, shrinking and adding chunks as needed
-    if (ptr != begin) {
+    return idx;
+  }
 
-      // shrink end of current free region to [ptr, begin)
-      iter->second = begin;
+  memory_chunk m_allocation;
+  //! bit fl is set if any list in m_sl_bitmap[fl] is non-empty
+  uint64_t m_fl_bitmap;
+  //! bit sl of m_sl_bitmap[fl] is set if m_free_heads[fl][sl] is non-empty
+  uint64_t m_sl_bitmap[fl_count];
+  chunk_index m_free_heads[fl_count][sl_count];
+  std::vector<chunk> m_chunks;
+  std::vector<chunk_index> m_unused_chunks;
+  //! used chunks by offset, empty slots have index null_chunk
+  std::vector<used_entry> m_used_table;
+  size_t m_num_used;
+};
 
-      if (end != ptr_end) {
+/*! \class MemPoolThreadCache
+ ******************************************************************************
+ *
+ * \brief  MemPoolThreadCache is a per-thread front end for class MemPool
+ * that serves small allocations from power of two size classes
+ *
+ * Each size class is carved out of slabs of slab_size bytes that are
+ * allocated from the MemPool arenas and aligned to slab_size, so the slab
+ * containing a block is found by masking the block address. Free blocks are
+ * kept as pointers on the host so the memory itself is never touched.
+ *
+ * Blocks freed by a thread that does not own the slab are queued on the
+ * owner with give_remote and picked up by the owner the next time it misses.
+ *
+ ******************************************************************************
+ */
+class MemPoolThreadCache
+{
+public:
+  static const size_t min_class_size = 16;
+  static const int num_size_classes = 9;
+  static const size_t max_class_size = min_class_size << (num_size_classes - 1);
+  static const size_t slab_size = 64ull * 1024ull;
 
-        // insert free region [end, ptr_end) after current free region
-        free_type::iterator next = iter;
-        ++next;
-        m_free_space.insert(next, free_value_type{end, ptr_end});
-      }
+  //! size class able to hold nbytes with the given alignment, or -1
+  static int size_class(size_t nbytes, size_t alignment)
+  {
+    size_t size = (nbytes < alignment) ? alignment : nbytes;
+    if (size > max_class_size) {
+      return -1;
+    }
+    int size_class = 0;
+    while ((min_class_size << size_class) < size) {
+      ++size_class;
+    }
+    return size_class;
+  }
 
-    } else if (end != ptr_end) {
+  static size_t class_size(int size_class)
+  {
+    return min_class_size << size_class;
+  }
 
-      // shrink beginning of current free region to [end, ptr_end)
-      free_type::iterator next = iter;
-      ++next;
-      m_free_space.insert(next, free_value_type{end, ptr_end});
-      m_free_space.erase(iter);
+  static void* slab_of(void* ptr)
+  {
+    return reinterpret_cast<void*>(reinterpret_cast<std::uintptr_t>(ptr) &
+                                   ~static_cast<std::uintptr_t>(slab_size - 1));
+  }
 
-    } else {
+  MemPoolThreadCache() = default;
+
+  MemPoolThreadCache(MemPoolThreadCache const&) = delete;
+  MemPoolThreadCache& operator=(MemPoolThreadCache const&) = delete;
 
-      // can not reuse current region, erase
-      m_free_space.erase(iter);
+  void* get(int size_class)
+  {
+    std::vector<void*>& blocks = m_free_blocks[size_class];
+    if (blocks.empty()) {
+      return nullptr;
     }
+    void* ptr = blocks.back();
+    blocks.pop_back();
+    return ptr;
   }
 
-  void add_used_chunk(void* begin, void* end)
+  //! returns true if ptr belongs to a slab owned by this cache
+  bool give(void* ptr)
   {
-    // simply inserts a chunk of memory into used_space
-    m_used_space.insert(used_value_type{begin, end});
+    slab_container_type::iterator slab = find_slab(slab_of(ptr));
+    if (slab == m_slabs.end()) {
+      return false;
+    }
+    m_free_blocks[slab->size_class].push_back(ptr);
+    return true;
   }
 
-  memory_chunk m_allocation;
-  free_type m_free_space;
-  used_type m_used_space;
+  //! queue a block freed by another thread, the caller must synchronize
+  void give_remote(void* ptr) { m_remote_free.push_back(ptr); }
+
+  //! take back blocks freed by other threads, the caller must synchronize
+  void drain_remote()
+  {
+    for (void* ptr : m_remote_free) {
+      bool given = give(ptr);
+      assert(given);
+      static_cast<void>(given);
+    }
+    m_remote_free.clear();
+  }
+
+  //! split a new slab into blocks of the given size class
+  void add_slab(void* slab_ptr, int size_class)
+  {
+    slab_container_type::iterator next =
+        std::lower_bound(m_slabs.begin(), m_slabs.end(), slab_ptr, slab_less);
+    m_slabs.insert(next, slab_type{slab_ptr, size_class});
+
+    const size_t block_size = class_size(size_class);
+    std::vector<void*>& blocks = m_free_blocks[size_class];
+    // push in reverse so blocks are handed out in address order
+    for (size_t offset = slab_size; offset >= block_size; offset -= block_size) {
+      blocks.push_back(static_cast<char*>(slab_ptr) + offset - block_size);
+    }
+  }
+
+  void clear()
+  {
+    for (std::vector<void*>& blocks : m_free_blocks) {
+      blocks.clear();
+    }
+    m_slabs.clear();
+    m_remote_free.clear();
+  }
+
+#if defined(RAJA_ENABLE_OPENMP)
+  omp::mutex& mutex() { return m_mutex; }
+#endif
+
+private:
+  struct slab_type {
+    void* begin;
+    int size_class;
+  };
+  using slab_container_type = std::vector<slab_type>;
+
+  static bool slab_less(slab_type const& slab, void* ptr)
+  {
+    return std::less<void*>{}(slab.begin, ptr);
+  }
+
+  slab_container_type::iterator find_slab(void* slab_ptr)
+  {
+    slab_container_type::iterator slab =
+        std::lower_bound(m_slabs.begin(), m_slabs.end(), slab_ptr, slab_less);
+    if (slab != m_slabs.end() && slab->begin == slab_ptr) {
+      return slab;
+    }
+    return m_slabs.end();
+  }
+
+#if defined(RAJA_ENABLE_OPENMP)
+  omp::mutex m_mutex;
+#endif
+
+  std::vector<void*> m_free_blocks[num_size_classes];
+  slab_container_type m_slabs;
+  std::vector<void*> m_remote_free;
+
+  // keep caches used by different threads on separate cache lines
+  char m_pad[64];
 };
 
 } /* end namespace detail */
@@ -249,7 +639,9 @@ private:
  * malloc/free for the user to allocate aligned data within the pool
  *
  * MemPool uses MemoryArena to do the heavy lifting of maintaining access to
- * the used/free space.
+ * the used/free space. Small allocations are served from per-thread
+ * MemPoolThreadCache size classes so only cache misses lock the pool,
+ * memory given to the caches stays with them until free_chunks is called.
  *
  * MemPool provides an example generic_allocator which can guide more
  *specialized
@@ -297,8 +689,21 @@ public:
   static const size_t default_default_arena_size = 32ull * 1024ull * 1024ull;
 
   MemPool()
-      : m_arenas(), m_default_arena_size(default_default_arena_size), m_alloc()
+      : m_arenas(),
+        m_default_arena_size(default_default_arena_size),
+        m_alloc(),
+        m_caches(),
+        m_cache_slabs(),
+        m_use_thread_caches(true)
   {
+    int num_caches = 1;
+#if defined(RAJA_ENABLE_OPENMP)
+    num_caches = std::max(omp_get_max_threads(), omp_get_num_procs());
+#endif
+    m_caches.reserve(num_caches);
+    for (int i = 0; i < num_caches; ++i) {
+      m_caches.emplace_back(new cache_type());
+    }
   }
 
   ~MemPool()
@@ -312,14 +717,31 @@ public:
   void free_chunks()
   {
 #if defined(RAJA_ENABLE_OPENMP)
-    lock_guard<omp::mutex> lock(m_mutex);
+    // thread caches are always locked before the pool
+    for (std::unique_ptr<cache_type>& cache : m_caches) {
+      cache->mutex().lock();
+    }
+    {
+      lock_guard<omp::mutex> lock(m_mutex);
 #endif
 
-    while (!m_arenas.empty()) {
-      void* allocation_ptr = m_arenas.front().get_allocation();
-      m_alloc.free(allocation_ptr);
-      m_arenas.pop_front();
+      for (std::unique_ptr<cache_type>& cache : m_caches) {
+        cache->clear();
+      }
+      m_cache_slabs.clear();
+
+      while (!m_arenas.empty()) {
+        void* allocation_ptr = m_arenas.front().get_allocation();
+        m_alloc.free(allocation_ptr);
+        m_arenas.pop_front();
+      }
+
+#if defined(RAJA_ENABLE_OPENMP)
     }
+    for (std::unique_ptr<cache_type>& cache : m_caches) {
+      cache->mutex().unlock();
+    }
+#endif
   }
 
   size_t arena_size()
@@ -342,44 +764,68 @@ public:
     return prev_size;
   }
 
+  //! true if small allocations are served from per-thread caches
+  bool thread_caches() { return m_use_thread_caches.load(); }
+
+  //! enable or disable the per-thread caches, returns the previous setting
+  //! blocks already handed out by the caches may still be freed either way
+  bool thread_caches(bool enable) { return m_use_thread_caches.exchange(enable); }
+
   template <typename T>
   T* malloc(size_t nTs, size_t alignment = alignof(T))
   {
+    const size_t size = nTs * sizeof(T);
+
+    const int size_class = cache_type::size_class(size, alignment);
+    if (size_class >= 0 && m_use_thread_caches.load(std::memory_order_relaxed)) {
+      cache_type* cache = get_thread_cache();
+      if (cache != nullptr) {
 #if defined(RAJA_ENABLE_OPENMP)
-    lock_guard<omp::mutex> lock(m_mutex);
+        lock_guard<omp::mutex> cache_lock(cache->mutex());
 #endif
 
-    const size_t size = nTs * sizeof(T);
-    void* ptr = nullptr;
-    arena_container_type::iterator end = m_arenas.end();
-    for (arena_container_type::iterator iter = m_arenas.begin(); iter != end;
-         ++iter) {
-      ptr = iter->get(size, alignment);
-      if (ptr != nullptr) {
-        break;
+        void* ptr = cache->get(size_class);
+        if (ptr == nullptr) {
+          ptr = refill_cache(*cache, size_class);
+        }
+        return static_cast<T*>(ptr);
       }
     }
 
-    if (ptr == nullptr) {
-      const size_t alloc_size =
-          std::max(size + alignment, m_default_arena_size);
-      void* arena_ptr = m_alloc.malloc(alloc_size);
-      if (arena_ptr != nullptr) {
-        m_arenas.emplace_front(arena_ptr, alloc_size);
-        ptr = m_arenas.front().get(size, alignment);
-      }
-    }
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
 
-    return static_cast<T*>(ptr);
+    return static_cast<T*>(arena_malloc(size, alignment));
   }
 
   void free(const void* cptr)
   {
+    void* ptr = const_cast<void*>(cptr);
+
+    cache_type* cache = get_thread_cache();
+    if (cache != nullptr) {
+#if defined(RAJA_ENABLE_OPENMP)
+      lock_guard<omp::mutex> cache_lock(cache->mutex());
+#endif
+
+      if (cache->give(ptr)) {
+        return;
+      }
+    }
+
 #if defined(RAJA_ENABLE_OPENMP)
     lock_guard<omp::mutex> lock(m_mutex);
 #endif
 
-    void* ptr = const_cast<void*>(cptr);
+    // block from a slab owned by the cache of another thread
+    cache_slab_container_type::iterator slab =
+        m_cache_slabs.find(cache_type::slab_of(ptr));
+    if (slab != m_cache_slabs.end()) {
+      slab->second->give_remote(ptr);
+      return;
+    }
+
     arena_container_type::iterator end = m_arenas.end();
     for (arena_container_type::iterator iter = m_arenas.begin(); iter != end;
          ++iter) {
@@ -395,6 +841,69 @@ public:
 
 private:
   using arena_container_type = std::list<detail::MemoryArena>;
+  using cache_type = detail::MemPoolThreadCache;
+  using cache_container_type = std::vector<std::unique_ptr<cache_type>>;
+  using cache_slab_container_type = std::map<void*, cache_type*>;
+
+  //! cache of the calling thread, or nullptr if it has none
+  cache_type* get_thread_cache()
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    const size_t tid = static_cast<size_t>(omp_get_thread_num());
+    return (tid < m_caches.size()) ? m_caches[tid].get() : nullptr;
+#else
+    return m_caches.front().get();
+#endif
+  }
+
+  //! get a block for an empty size class of the locked cache
+  void* refill_cache(cache_type& cache, int size_class)
+  {
+#if defined(RAJA_ENABLE_OPENMP)
+    lock_guard<omp::mutex> lock(m_mutex);
+#endif
+
+    cache.drain_remote();
+    void* ptr = cache.get(size_class);
+
+    if (ptr == nullptr) {
+      void* slab_ptr =
+          arena_malloc(cache_type::slab_size, cache_type::slab_size);
+      if (slab_ptr != nullptr) {
+        m_cache_slabs.emplace(slab_ptr, &cache);
+        cache.add_slab(slab_ptr, size_class);
+        ptr = cache.get(size_class);
+      }
+    }
+
+    return ptr;
+  }
+
+  //! allocate from the arenas, the pool must be locked
+  void* arena_malloc(size_t size, size_t alignment)
+  {
+    void* ptr = nullptr;
+    arena_container_type::iterator end = m_arenas.end();
+    for (arena_container_type::iterator iter = m_arenas.begin(); iter != end;
+         ++iter) {
+      ptr = iter->get(size, alignment);
+      if (ptr != nullptr) {
+        break;
+      }
+    }
+
+    if (ptr == nullptr) {
+      const size_t alloc_size =
+          std::max(size + alignment, m_default_arena_size);
+      void* arena_ptr = m_alloc.malloc(alloc_size);
+      if (arena_ptr != nullptr) {
+        m_arenas.emplace_front(arena_ptr, alloc_size);
+        ptr = m_arenas.front().get(size, alignment);
+      }
+    }
+
+    return ptr;
+  }
 
 #if defined(RAJA_ENABLE_OPENMP)
   omp::mutex m_mutex;
@@ -403,6 +912,12 @@ private:
   arena_container_type m_arenas;
   size_t m_default_arena_size;
   allocator_t m_alloc;
+
+  //! per-thread caches for small allocations, indexed by thread number
+  cache_container_type m_caches;
+  //! slabs owned by the thread caches:    slab -> owning cache
+  cache_slab_container_type m_cache_slabs;
+  std::atomic<bool> m_use_thread_caches;
 };
 
 //! example allocator for basic_mempool using malloc/free
@@ -10,6 +10,12 @@
 
 #include "RAJA/config.hpp"
 
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "camp/camp.hpp"
+
 #include "RAJA/util/PluginContext.hpp"
 #include "RAJA/util/PluginOptions.hpp"
 #include "RAJA/util/PluginStrategy.hpp"
@@ -19,8 +25,107 @@
 #endif
 
 namespace RAJA {
+
+namespace detail {
+
+struct iteration_count_fallback {};
+struct iteration_count_range : iteration_count_fallback {};
+struct iteration_count_exact : iteration_count_range {};
+
+template <typename T>
+std::size_t iteration_count(T const& space);
+
+//! unknown iteration space
+template <typename T>
+std::size_t iteration_count_impl(T const&, iteration_count_fallback)
+{
+  return 0;
+}
+
+//! random-access ranges, such as segments and containers
+template <typename T>
+auto iteration_count_impl(T const& range, iteration_count_range)
+    -> decltype(std::distance(std::begin(range), std::end(range)),
+                std::size_t())
+{
+  return static_cast<std::size_t>(
+      std::distance(std::begin(range), std::end(range)));
+}
+
+//! index sets
+template <typename T>
+auto iteration_count_impl(T const& iset, iteration_count_exact)
+    -> decltype(iset.getLength(), std::size_t())
+{
+  return static_cast<std::size_t>(iset.getLength());
+}
+
+//! explicit counts
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value, std::size_t>::type
+iteration_count_impl(T const& count, iteration_count_exact)
+{
+  return static_cast<std::size_t>(count);
+}
+
+template <typename Tuple, camp::idx_t... Is>
+std::size_t iteration_count_tuple(Tuple const& segments, camp::idx_seq<Is...>)
+{
+  std::size_t count = 1;
+  int expand[] = {0, (count *= iteration_count(camp::get<Is>(segments)), 0)...};
+  (void)expand;
+  return count;
+}
+
+//! kernel segment tuples: the size of the full product space
+template <typename... Segments>
+std::size_t iteration_count_impl(camp::tuple<Segments...> const& segments,
+                                 iteration_count_exact)
+{
+  return iteration_count_tuple(segments,
+                               camp::make_idx_seq_t<sizeof...(Segments)>{});
+}
+
+template <typename T>
+std::size_t iteration_count(T const& space)
+{
+  return iteration_count_impl(space, iteration_count_exact{});
+}
+
+}  // closing brace for detail namespace
+
 namespace util {
 
+/*!
+ * \brief Make the context passed to plugins by a RAJA pattern.
+ *
+ * The kernel metadata is only filled in when at least one plugin is
+ * registered; otherwise this costs one registry lookup, and the plugin
+ * calls made with the returned context return without iterating.
+ *
+ * \param pattern RAJA pattern making the context
+ * \param space iteration space, or an explicit iteration count; when it is
+ *        omitted or its size cannot be determined num_iterations is 0
+ * \param kernel_name optional user-supplied name for the kernel
+ */
+template <typename Policy, typename Body, typename IterSpace = camp::nil>
+PluginContext make_context(Pattern pattern,
+                           IterSpace const& space = IterSpace{},
+                           const char* kernel_name = nullptr)
+{
+  PluginContext context{make_context<Policy>()};
+  context.pattern = pattern;
+  context.has_plugins = PluginRegistry::begin() != PluginRegistry::end();
+  if (context.has_plugins) {
+    context.kernel_name = kernel_name;
+    context.kernel_id =
+        kernel_name ? kernel_name : RAJA::detail::type_name<Body>();
+    context.policy_name = RAJA::detail::type_name<Policy>();
+    context.num_iterations = RAJA::detail::iteration_count(space);
+  }
+  return context;
+}
+
 template <typename T>
 RAJA_INLINE auto trigger_updates_before(T&& item)
   -> typename std::remove_reference<T>::type
@@ -32,6 +137,8 @@ RAJA_INLINE
 void
 callPreCapturePlugins(const PluginContext& p)
 {
+  if (!p.has_plugins) return;
+
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
@@ -44,6 +151,8 @@ RAJA_INLINE
 void
 callPostCapturePlugins(const PluginContext& p)
 {
+  if (!p.has_plugins) return;
+
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
@@ -56,6 +165,8 @@ RAJA_INLINE
 void
 callPreLaunchPlugins(const PluginContext& p)
 {
+  if (!p.has_plugins) return;
+
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
@@ -68,6 +179,8 @@ RAJA_INLINE
 void
 callPostLaunchPlugins(const PluginContext& p)
 {
+  if (!p.has_plugins) return;
+
   for (auto plugin = PluginRegistry::begin();
       plugin != PluginRegistry::end();
       ++plugin)
@@ -20,12 +20,21 @@
 
 #include "RAJA/config.hpp"
 
+#include <climits>
+#include <cstdint>
+#include <cstring>
 #include <iterator>
 #include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
 
 #include "RAJA/pattern/detail/algorithm.hpp"
 
+#include "RAJA/internal/MemUtils_CPU.hpp"
+
 #include "RAJA/util/macros.hpp"
+#include "RAJA/util/Operators.hpp"
 
 #include "RAJA/util/concepts.hpp"
 
@@ -693,6 +702,356 @@ merge_sort(Iter begin,
   //}
 }
 
+/*!
+    \brief maps keys of type T to unsigned integers whose ascending order
+    is the ascending order of the keys, if T has such a mapping
+*/
+template <typename T, typename Enable = void>
+struct radix_sort_key_traits
+{
+  static constexpr bool value = false;
+};
+
+///
+template <typename T>
+struct radix_sort_key_traits<T,
+    typename std::enable_if<std::is_integral<T>::value &&
+                            !std::is_same<T, bool>::value>::type>
+{
+  static constexpr bool value = true;
+  using bits_type = typename std::make_unsigned<T>::type;
+
+  static RAJA_INLINE bits_type to_bits(T key)
+  {
+    bits_type bits = static_cast<bits_type>(key);
+    if (std::is_signed<T>::value) {
+      // flip the sign bit so negative keys order before positive keys
+      bits ^= static_cast<bits_type>(1) << (sizeof(bits_type)*CHAR_BIT - 1);
+    }
+    return bits;
+  }
+};
+
+///
+template <typename T>
+struct radix_sort_key_traits<T,
+    typename std::enable_if<std::is_floating_point<T>::value &&
+                            (sizeof(T) == sizeof(uint32_t) ||
+                             sizeof(T) == sizeof(uint64_t))>::type>
+{
+  static constexpr bool value = true;
+  using bits_type = typename std::conditional<sizeof(T) == sizeof(uint32_t),
+                                              uint32_t, uint64_t>::type;
+
+  static RAJA_INLINE bits_type to_bits(T key)
+  {
+    constexpr bits_type sign = static_cast<bits_type>(1) << (sizeof(bits_type)*CHAR_BIT - 1);
+    bits_type bits;
+    std::memcpy(&bits, &key, sizeof(bits_type));
+    // -0 compares equal to +0 so it must map to the same bits
+    if (bits == sign) {
+      bits = 0;
+    }
+    // negative keys order in reverse and before positive keys
+    return (bits & sign) ? ~bits : (bits | sign);
+  }
+};
+
+/*!
+    \brief true if a radix sort of keys from Iter gives the same order as a
+    stable sort with Compare, which is the case for arithmetic keys with
+    RAJA::operators::less or RAJA::operators::greater
+*/
+template <typename Iter, typename Compare>
+struct radix_sortable
+  : std::integral_constant<bool,
+      radix_sort_key_traits<IterVal<Iter>>::value &&
+      std::is_base_of<std::random_access_iterator_tag,
+          typename std::iterator_traits<Iter>::iterator_category>::value &&
+      (std::is_same<Compare, operators::less<IterVal<Iter>>>::value ||
+       std::is_same<Compare, operators::greater<IterVal<Iter>>>::value)>
+{
+};
+
+/*!
+    \brief minimum number of items in a range before a radix sort is used
+    instead of a comparison sort
+*/
+constexpr size_t radix_sort_min_items() { return 1024; }
+
+/*!
+    \brief minimum number of items each part of a radix sort pass handles
+*/
+constexpr size_t radix_sort_min_items_per_part() { return 16384; }
+
+/*!
+    \brief radix sort digit of the given key bits
+*/
+template <bool Descending, typename Traits, typename Key>
+RAJA_INLINE size_t radix_sort_digit(Key const& key, unsigned shift)
+{
+  typename Traits::bits_type bits = Traits::to_bits(key);
+  if (Descending) {
+    bits = ~bits;
+  }
+  return static_cast<size_t>((bits >> shift) & 0xFF);
+}
+
+///
+template <typename DstIter, typename SrcIter>
+RAJA_INLINE void radix_sort_store_value(std::true_type, DstIter dst, SrcIter src)
+{
+  new (&*dst) IterVal<DstIter>(std::move(*src));
+}
+///
+template <typename DstIter, typename SrcIter>
+RAJA_INLINE void radix_sort_store_value(std::false_type, DstIter dst, SrcIter src)
+{
+  *dst = std::move(*src);
+}
+
+/*!
+    \brief count the digits of keys in [i_begin, i_end) into hist
+*/
+template <bool Descending, typename Traits, typename KeyIter>
+RAJA_INLINE void radix_sort_count(KeyIter keys,
+                                  size_t i_begin,
+                                  size_t i_end,
+                                  unsigned shift,
+                                  size_t* hist)
+{
+  for (size_t d = 0; d < 256; ++d) {
+    hist[d] = 0;
+  }
+  for (size_t i = i_begin; i < i_end; ++i) {
+    ++hist[radix_sort_digit<Descending, Traits>(keys[i], shift)];
+  }
+}
+
+/*!
+    \brief scatter keys (and values) in [i_begin, i_end) to the positions in
+    offsets, keeping the order of items with the same digit
+*/
+template <bool Descending, typename Traits, bool HasVals, bool ConstructVals,
+          typename SrcKeyIter, typename DstKeyIter,
+          typename SrcValIter, typename DstValIter>
+RAJA_INLINE void radix_sort_scatter(SrcKeyIter src_keys,
+                                    DstKeyIter dst_keys,
+                                    SrcValIter src_vals,
+                                    DstValIter dst_vals,
+                                    size_t i_begin,
+                                    size_t i_end,
+                                    unsigned shift,
+                                    size_t* offsets)
+{
+  for (size_t i = i_begin; i < i_end; ++i) {
+    const size_t pos = offsets[radix_sort_digit<Descending, Traits>(src_keys[i], shift)]++;
+    dst_keys[pos] = src_keys[i];
+    if (HasVals) {
+      radix_sort_store_value(std::integral_constant<bool, ConstructVals>{},
+                             dst_vals + pos, src_vals + i);
+    }
+  }
+}
+
+/*!
+    \brief stable least significant digit radix sort of n keys and optionally
+    n values, 8 bits per pass
+
+    Each pass splits the range into parts.num_parts(n) parts. parts(num, fn)
+    must call fn(part) for every part in [0, num), possibly in parallel, and
+    return once all calls have finished. Each part counts its digits into
+    its own histogram and scatters its items in order, so the sort is
+    stable. Passes in which every key has the same digit are skipped.
+*/
+template <bool Descending, bool HasVals, typename Parts,
+          typename KeyIter, typename ValIter>
+inline void radix_sort(Parts&& parts, KeyIter keys, ValIter vals, size_t n)
+{
+  using key_type = IterVal<KeyIter>;
+  using val_type = IterVal<ValIter>;
+  using Traits = radix_sort_key_traits<key_type>;
+  using bits_type = typename Traits::bits_type;
+
+  constexpr size_t num_buckets = 256;
+  constexpr unsigned num_passes = sizeof(bits_type);
+
+  const size_t num_parts = parts.num_parts(n);
+  std::vector<size_t> hist(num_parts * num_buckets);
+
+  auto part_begin = [&](size_t part) { return firstIndex(n, num_parts, part); };
+
+  // Manage the lifetime of the buffers and objects constructed in them
+  std::unique_ptr<key_type, FreeAligned> key_buf(
+      RAJA::allocate_aligned_type<key_type>( RAJA::DATA_ALIGN, n * sizeof(key_type) ));
+
+  using val_deleter_type = FreeAlignedType<val_type, size_t>;
+  val_deleter_type val_deleter;
+  std::unique_ptr<val_type, val_deleter_type&> val_buf(
+      HasVals ? RAJA::allocate_aligned_type<val_type>( RAJA::DATA_ALIGN, n * sizeof(val_type) )
+              : nullptr,
+      val_deleter);
+
+  key_type* key_scratch = key_buf.get();
+  val_type* val_scratch = val_buf.get();
+
+  // check memory allocation worked
+  if (key_scratch == nullptr || (HasVals && val_scratch == nullptr)) {
+    RAJA_ABORT_OR_THROW( "radix_sort temporary memory allocation failed" );
+  }
+
+  bool in_scratch = false;
+
+  for (unsigned pass = 0; pass < num_passes; ++pass) {
+
+    const unsigned shift = pass * 8;
+
+    parts(num_parts, [&](size_t part) {
+      if (in_scratch) {
+        radix_sort_count<Descending, Traits>(key_scratch, part_begin(part),
+            part_begin(part+1), shift, &hist[part * num_buckets]);
+      } else {
+        radix_sort_count<Descending, Traits>(keys, part_begin(part),
+            part_begin(part+1), shift, &hist[part * num_buckets]);
+      }
+    });
+
+    // turn counts into each part's first output position for each digit
+    bool skip_pass = false;
+    size_t running = 0;
+    for (size_t d = 0; d < num_buckets; ++d) {
+      const size_t digit_begin = running;
+      for (size_t part = 0; part < num_parts; ++part) {
+        const size_t count = hist[part * num_buckets + d];
+        hist[part * num_buckets + d] = running;
+        running += count;
+      }
+      if (running - digit_begin == n) {
+        skip_pass = true;
+        break;
+      }
+    }
+    if (skip_pass) {
+      continue;
+    }
+
+    const bool construct_vals = (val_deleter.size == 0);
+
+    parts(num_parts, [&](size_t part) {
+      const size_t i_begin = part_begin(part);
+      const size_t i_end = part_begin(part+1);
+      size_t* offsets = &hist[part * num_buckets];
+      if (in_scratch) {
+        radix_sort_scatter<Descending, Traits, HasVals, false>(
+            key_scratch, keys, val_scratch, vals,
+            i_begin, i_end, shift, offsets);
+      } else if (construct_vals) {
+        radix_sort_scatter<Descending, Traits, HasVals, true>(
+            keys, key_scratch, vals, val_scratch,
+            i_begin, i_end, shift, offsets);
+      } else {
+        radix_sort_scatter<Descending, Traits, HasVals, false>(
+            keys, key_scratch, vals, val_scratch,
+            i_begin, i_end, shift, offsets);
+      }
+    });
+
+    if (HasVals) {
+      // the first scatter constructed every value in scratch
+      val_deleter.size = n;
+    }
+    in_scratch = !in_scratch;
+  }
+
+  if (in_scratch) {
+    parts(num_parts, [&](size_t part) {
+      const size_t i_begin = part_begin(part);
+      const size_t i_end = part_begin(part+1);
+      for (size_t i = i_begin; i < i_end; ++i) {
+        keys[i] = key_scratch[i];
+        if (HasVals) {
+          vals[i] = std::move(val_scratch[i]);
+        }
+      }
+    });
+  }
+}
+
+/*!
+    \brief radix sort [begin, end) and return true if the keys and
+    comparison allow it and the range is large enough, otherwise return false
+*/
+template <typename Parts, typename Iter, typename Compare>
+RAJA_INLINE
+concepts::enable_if_t<bool, radix_sortable<Iter, Compare>>
+try_radix_sort(Parts&& parts, Iter begin, Iter end, Compare)
+{
+  const size_t n = static_cast<size_t>(end - begin);
+  if (n < radix_sort_min_items()) {
+    return false;
+  }
+  constexpr bool descending =
+      std::is_same<Compare, operators::greater<IterVal<Iter>>>::value;
+  radix_sort<descending, false>(parts, begin, begin, n);
+  return true;
+}
+///
+template <typename Parts, typename Iter, typename Compare>
+RAJA_INLINE
+concepts::enable_if_t<bool, concepts::negate<radix_sortable<Iter, Compare>>>
+try_radix_sort(Parts&&, Iter, Iter, Compare)
+{
+  return false;
+}
+
+/*!
+    \brief radix sort pairs of keys [keys_begin, keys_end) and values from
+    vals_begin and return true if the keys and comparison allow it and the
+    range is large enough, otherwise return false
+*/
+template <typename Parts, typename KeyIter, typename ValIter, typename Compare>
+RAJA_INLINE
+concepts::enable_if_t<bool, radix_sortable<KeyIter, Compare>>
+try_radix_sort_pairs(Parts&& parts,
+                     KeyIter keys_begin,
+                     KeyIter keys_end,
+                     ValIter vals_begin,
+                     Compare)
+{
+  const size_t n = static_cast<size_t>(keys_end - keys_begin);
+  if (n < radix_sort_min_items()) {
+    return false;
+  }
+  constexpr bool descending =
+      std::is_same<Compare, operators::greater<IterVal<KeyIter>>>::value;
+  radix_sort<descending, true>(parts, keys_begin, vals_begin, n);
+  return true;
+}
+///
+template <typename Parts, typename KeyIter, typename ValIter, typename Compare>
+RAJA_INLINE
+concepts::enable_if_t<bool, concepts::negate<radix_sortable<KeyIter, Compare>>>
+try_radix_sort_pairs(Parts&&, KeyIter, KeyIter, ValIter, Compare)
+{
+  return false;
+}
+
+/*!
+    \brief runs the parts of a radix sort one after another
+*/
+struct SequentialRadixParts
+{
+  size_t num_parts(size_t) const { return 1; }
+
+  template <typename Func>
+  void operator()(size_t num, Func&& func) const
+  {
+    for (size_t part = 0; part < num; ++part) {
+      func(part);
+    }
+  }
+};
+
 }  // namespace detail
 
 /*!
@@ -79,3 +79,73 @@ TEST(IndexSetBuild, Aligned)
   ASSERT_EQ(s4.size(), 2);
   ASSERT_EQ(*s4.begin(), 30);
 }
+
+template <typename EXEC_POLICY>
+void AlignedParallelTestImpl(std::vector<RAJA::Index_type> const& indices,
+                             RAJA::Index_type range_min_length,
+                             RAJA::Index_type range_align)
+{
+  using RSType = RAJA::RangeSegment;
+  using LSType = RAJA::ListSegment;
+
+  camp::resources::Resource res{camp::resources::Host()};
+
+  RAJA::TypedIndexSet<RSType, LSType> serial_iset;
+  RAJA::buildIndexSetAligned(serial_iset,
+                             res,
+                             indices.data(),
+                             static_cast<RAJA::Index_type>(indices.size()),
+                             range_min_length,
+                             range_align);
+
+  RAJA::TypedIndexSet<RSType, LSType> iset;
+  RAJA::buildIndexSetAligned<EXEC_POLICY>(
+      iset,
+      res,
+      indices.data(),
+      static_cast<RAJA::Index_type>(indices.size()),
+      range_min_length,
+      range_align);
+
+  ASSERT_EQ(iset.getLength(), indices.size());
+  ASSERT_TRUE(iset == serial_iset);
+}
+
+template <typename EXEC_POLICY>
+void AlignedParallelTest()
+{
+  // runs of consecutive indices of varying length, with runs long enough
+  // to cross the builder's internal chunks
+  std::vector<RAJA::Index_type> indices;
+  RAJA::Index_type next = 3;
+  for (int run = 0; run < 2000; ++run) {
+    RAJA::Index_type run_length = (run * 7919) % 257 + 1;
+    if (run % 97 == 0) {
+      run_length = 150000;
+    }
+    for (RAJA::Index_type i = 0; i < run_length; ++i) {
+      indices.push_back(next++);
+    }
+    next += run % 5;
+  }
+
+  AlignedParallelTestImpl<EXEC_POLICY>(indices, 8, 2);
+  AlignedParallelTestImpl<EXEC_POLICY>(indices, 8, 64);
+
+  std::vector<RAJA::Index_type> few(indices.begin(), indices.begin() + 5);
+  AlignedParallelTestImpl<EXEC_POLICY>(few, 8, 2);
+  AlignedParallelTestImpl<EXEC_POLICY>(few, 0, 2);
+}
+
+TEST(IndexSetBuild, AlignedSequential)
+{
+  AlignedParallelTest<RAJA::seq_exec>();
+  AlignedParallelTest<RAJA::loop_exec>();
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(IndexSetBuild, AlignedOpenMP)
+{
+  AlignedParallelTest<RAJA::omp_parallel_for_exec>();
+}
+#endif
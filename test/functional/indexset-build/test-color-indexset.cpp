@@ -0,0 +1,189 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the lock-free color index set builders.
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/index/IndexSetBuilders.hpp"
+
+#include "camp/resource.hpp"
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+using ColorIndexSet = RAJA::TypedIndexSet<RAJA::RangeSegment, RAJA::ListSegment>;
+
+//
+// Segment visitor that records the indices of a segment and whether it is a
+// RangeSegment.
+//
+struct CollectSegment {
+  std::vector<RAJA::Index_type>* indices;
+  bool* isRange;
+
+  template <typename SEG_TYPE>
+  void operator()(SEG_TYPE const& seg) const
+  {
+    *isRange = std::is_same<SEG_TYPE, RAJA::RangeSegment>::value;
+    for (auto idx : seg) {
+      indices->push_back(idx);
+    }
+  }
+};
+
+//
+// Zone to node connectivity of an nx by ny quad mesh; every node is shared
+// by at most four zones.
+//
+static std::vector<RAJA::Index_type> quadMeshZoneToNode(int nx, int ny)
+{
+  std::vector<RAJA::Index_type> zoneToNode(4 * nx * ny);
+  for (int j = 0; j < ny; ++j) {
+    for (int i = 0; i < nx; ++i) {
+      const int zone = j * nx + i;
+      const int node = j * (nx + 1) + i;
+      zoneToNode[4 * zone + 0] = node;
+      zoneToNode[4 * zone + 1] = node + 1;
+      zoneToNode[4 * zone + 2] = node + nx + 1;
+      zoneToNode[4 * zone + 3] = node + nx + 2;
+    }
+  }
+  return zoneToNode;
+}
+
+//
+// Check that each zone is in exactly one segment, that no two zones in a
+// segment share a node, and return the segment sizes.
+//
+static std::vector<size_t> checkColoring(
+    ColorIndexSet const& iset,
+    std::vector<RAJA::Index_type> const& zoneToNode,
+    int numZones,
+    int numNodes,
+    RAJA::Index_type const* elemPermutation)
+{
+  std::vector<int> seen(numZones, 0);
+  std::vector<size_t> sizes;
+
+  for (size_t s = 0; s < iset.getNumSegments(); ++s) {
+    std::vector<RAJA::Index_type> zones;
+    bool isRange = false;
+    iset.segmentCall(s, CollectSegment{&zones, &isRange});
+
+    // a permuted coloring is always a set of ranges
+    if (elemPermutation) {
+      EXPECT_TRUE(isRange);
+    }
+
+    std::vector<int> nodeUsed(numNodes, 0);
+    for (RAJA::Index_type idx : zones) {
+      RAJA::Index_type zone = elemPermutation ? elemPermutation[idx] : idx;
+      ++seen[zone];
+      for (int k = 0; k < 4; ++k) {
+        EXPECT_EQ(nodeUsed[zoneToNode[4 * zone + k]]++, 0);
+      }
+    }
+    sizes.push_back(zones.size());
+  }
+
+  for (int zone = 0; zone < numZones; ++zone) {
+    EXPECT_EQ(seen[zone], 1);
+  }
+  return sizes;
+}
+
+template <typename EXEC_POLICY>
+void ColorIndexSetTestImpl(int nx, int ny)
+{
+  const int numZones = nx * ny;
+  const int numNodes = (nx + 1) * (ny + 1);
+  std::vector<RAJA::Index_type> zoneToNode = quadMeshZoneToNode(nx, ny);
+
+  camp::resources::Resource res{camp::resources::Host()};
+
+  {
+    ColorIndexSet iset;
+    RAJA::buildLockFreeColorIndexset<EXEC_POLICY>(
+        iset, res, zoneToNode.data(), numZones, 4, numNodes);
+
+    ASSERT_EQ(iset.getLength(), static_cast<size_t>(numZones));
+    std::vector<size_t> sizes =
+        checkColoring(iset, zoneToNode, numZones, numNodes, nullptr);
+
+    // at most R*(R-1)+1 colors, and no color far above the average size
+    ASSERT_LE(sizes.size(), 13u);
+    const size_t target = (numZones + sizes.size() - 1) / sizes.size();
+    ASSERT_LE(*std::max_element(sizes.begin(), sizes.end()), 2 * target);
+  }
+
+  {
+    ColorIndexSet iset;
+    std::vector<RAJA::Index_type> perm(numZones), iperm(numZones);
+    RAJA::buildLockFreeColorIndexset<EXEC_POLICY>(
+        iset, res, zoneToNode.data(), numZones, 4, numNodes,
+        perm.data(), iperm.data());
+
+    ASSERT_EQ(iset.getLength(), static_cast<size_t>(numZones));
+    for (int zone = 0; zone < numZones; ++zone) {
+      ASSERT_EQ(perm[iperm[zone]], zone);
+    }
+    checkColoring(iset, zoneToNode, numZones, numNodes, perm.data());
+  }
+}
+
+TEST(IndexSetBuild, ColorSequential)
+{
+  ColorIndexSetTestImpl<RAJA::seq_exec>(1, 1);
+  ColorIndexSetTestImpl<RAJA::seq_exec>(13, 9);
+  ColorIndexSetTestImpl<RAJA::loop_exec>(64, 32);
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(IndexSetBuild, ColorOpenMP)
+{
+  ColorIndexSetTestImpl<RAJA::omp_parallel_for_exec>(13, 9);
+  ColorIndexSetTestImpl<RAJA::omp_parallel_for_exec>(200, 150);
+}
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+TEST(IndexSetBuild, ColorTBB)
+{
+  ColorIndexSetTestImpl<RAJA::tbb_for_exec>(200, 150);
+}
+#endif
+
+TEST(IndexSetBuild, ColorSingleRow)
+{
+  // a single row of zones: each zone shares nodes only with its left and
+  // right neighbors, so no color is contiguous without a permutation
+  const int numZones = 7;
+  std::vector<RAJA::Index_type> zoneToNode = quadMeshZoneToNode(numZones, 1);
+  camp::resources::Resource res{camp::resources::Host()};
+
+  ColorIndexSet iset;
+  RAJA::buildLockFreeColorIndexset<RAJA::seq_exec>(
+      iset, res, zoneToNode.data(), numZones, 4, 2 * (numZones + 1));
+
+  ASSERT_EQ(iset.getNumSegments(), 2u);
+  ASSERT_EQ(iset.getLength(), static_cast<size_t>(numZones));
+
+  // alternating zones form the two colors
+  for (size_t s = 0; s < iset.getNumSegments(); ++s) {
+    std::vector<RAJA::Index_type> zones;
+    bool isRange = true;
+    iset.segmentCall(s, CollectSegment{&zones, &isRange});
+    ASSERT_FALSE(isRange);
+    for (size_t k = 1; k < zones.size(); ++k) {
+      ASSERT_EQ(zones[k] - zones[k - 1], 2);
+    }
+  }
+}
@@ -0,0 +1,145 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TEAMS_LOOP_SEGMENTS_HPP__
+#define __TEST_TEAMS_LOOP_SEGMENTS_HPP__
+
+#include <vector>
+
+//
+// Runs the multi-segment loop, loop_icount, tile and tile_icount patterns
+// with LOOP_POLICY, each writing data[i + N*(j + M*k)] for the local
+// indices of the segments. The segments have distinct lengths and offsets,
+// so swapped segments or local indices write other values or elements.
+//
+template <typename LAUNCH_POLICY, typename LOOP_POLICY, typename SEQ_POLICY>
+std::vector<int> TeamsLoopSegmentsRun()
+{
+  constexpr int N = 13;
+  constexpr int M = 7;
+  constexpr int K = 5;
+  constexpr int size = N * M * K;
+
+  constexpr int N0 = 2;
+  constexpr int M0 = 30;
+  constexpr int K0 = 60;
+
+  // one block of data per pattern, unwritten elements stay -1
+  std::vector<int> data(7 * size, -1);
+  int* loop2 = &data[0];
+  int* loop3 = &data[size];
+  int* icount2 = &data[2 * size];
+  int* icount3 = &data[3 * size];
+  int* tile = &data[4 * size];
+  int* tile_icount = &data[5 * size];
+  int* tile_local = &data[6 * size];
+
+  RAJA::RangeSegment seg0(N0, N0 + N);
+  RAJA::RangeSegment seg1(M0, M0 + M);
+  RAJA::RangeSegment seg2(K0, K0 + K);
+
+  RAJA::expt::launch<LAUNCH_POLICY>(
+      RAJA::expt::HOST,
+      RAJA::expt::Resources(RAJA::expt::Teams(N), RAJA::expt::Threads(M)),
+      [=](RAJA::expt::LaunchContext ctx) {
+
+        RAJA::expt::loop<LOOP_POLICY>(ctx, seg0, seg1, [&](int i, int j) {
+          loop2[(i - N0) + N * (j - M0)] = i + 100 * j;
+        });
+
+        RAJA::expt::loop<LOOP_POLICY>(
+            ctx, seg0, seg1, seg2, [&](int i, int j, int k) {
+              loop3[(i - N0) + N * ((j - M0) + M * (k - K0))] =
+                  i + 100 * j + 10000 * k;
+            });
+
+        RAJA::expt::loop_icount<LOOP_POLICY>(
+            ctx, seg0, seg1, [&](int i, int j, int ii, int jj) {
+              icount2[ii + N * jj] = i + 100 * j;
+            });
+
+        RAJA::expt::loop_icount<LOOP_POLICY>(
+            ctx,
+            seg0,
+            seg1,
+            seg2,
+            [&](int i, int j, int k, int ii, int jj, int kk) {
+              icount3[ii + N * (jj + M * kk)] = i + 100 * j + 10000 * k;
+            });
+
+        RAJA::expt::tile<LOOP_POLICY>(
+            ctx, 4, seg0, [&](RAJA::RangeSegment const& t) {
+              RAJA::expt::loop<SEQ_POLICY>(ctx, t, [&](int i) {
+                tile[i - N0] = *t.begin();
+              });
+            });
+
+        RAJA::expt::tile_icount<LOOP_POLICY>(
+            ctx, 3, seg1, [&](RAJA::RangeSegment const& t, int tx) {
+              RAJA::expt::loop_icount<SEQ_POLICY>(
+                  ctx, t, [&](int j, int jj) {
+                    tile_icount[j - M0] = tx;
+                    tile_local[j - M0] = jj;
+                  });
+            });
+      });
+
+  return data;
+}
+
+template <typename LAUNCH_POLICY, typename LOOP_POLICY, typename SEQ_POLICY>
+void TeamsLoopSegmentsTestImpl()
+{
+  std::vector<int> expected =
+      TeamsLoopSegmentsRun<LAUNCH_POLICY, SEQ_POLICY, SEQ_POLICY>();
+  std::vector<int> result =
+      TeamsLoopSegmentsRun<LAUNCH_POLICY, LOOP_POLICY, SEQ_POLICY>();
+
+  // the sequential loops write every element of the 2d and 3d patterns,
+  // and every element of the segments the 1d tiles cover
+  constexpr int size = 13 * 7 * 5;
+  for (int e = 0; e < 4 * size; ++e) {
+    ASSERT_NE(expected[e], -1);
+  }
+  for (int e = 0; e < 13; ++e) {
+    ASSERT_EQ(expected[4 * size + e], 2 + e / 4 * 4);
+  }
+  for (int e = 0; e < 7; ++e) {
+    ASSERT_EQ(expected[5 * size + e], e / 3);
+    ASSERT_EQ(expected[6 * size + e], e % 3);
+  }
+
+  ASSERT_EQ(result.size(), expected.size());
+  for (size_t e = 0; e < expected.size(); ++e) {
+    ASSERT_EQ(result[e], expected[e]) << "pattern " << e / size << ", element "
+                                      << e % size;
+  }
+}
+
+
+TYPED_TEST_SUITE_P(TeamsLoopSegmentsTest);
+template <typename T>
+class TeamsLoopSegmentsTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(TeamsLoopSegmentsTest, LoopSegmentsTeams)
+{
+
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<0>>::type;
+  using LOOP_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<1>>::type;
+  using SEQ_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<2>>::type;
+
+  TeamsLoopSegmentsTestImpl<LAUNCH_POLICY, LOOP_POLICY, SEQ_POLICY>();
+
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(TeamsLoopSegmentsTest,
+                            LoopSegmentsTeams);
+
+#endif  // __TEST_TEAMS_LOOP_SEGMENTS_HPP__
@@ -0,0 +1,95 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef __TEST_TEAMS_TEAM_SHARED_MEM_HPP__
+#define __TEST_TEAMS_TEAM_SHARED_MEM_HPP__
+
+template <typename WORKING_RES, typename LAUNCH_POLICY, typename TEAM_POLICY, typename THREAD_POLICY>
+void TeamsTeamSharedMemTestImpl()
+{
+
+  const int N = 100;
+  const int M = 64;
+
+  camp::resources::Resource working_res{WORKING_RES::get_default()};
+  int* working_array;
+  int* check_array;
+  int* test_array;
+
+  allocateForallTestData<int>(N*M,
+                             working_res,
+                             &working_array,
+                             &check_array,
+                             &test_array);
+
+  RAJA::expt::launch<LAUNCH_POLICY>(RAJA::expt::HOST,
+    RAJA::expt::Resources(RAJA::expt::Teams(N),
+                          RAJA::expt::Threads(4),
+                          RAJA::expt::SharedMem(M * sizeof(int))),
+        [=] RAJA_HOST_DEVICE(RAJA::expt::LaunchContext ctx) {
+
+          RAJA::expt::loop<TEAM_POLICY>(ctx, RAJA::RangeSegment(0, N), [&](int r) {
+
+                // Array shared within threads of the same team
+                int* s_A = ctx.getSharedMemory<int>(M);
+
+                RAJA::expt::loop<THREAD_POLICY>(ctx, RAJA::RangeSegment(0, M), [&](int c) {
+                    s_A[c] = c + M*r;
+                });
+
+                ctx.teamSync();
+
+                // each thread reads values written by other threads of the team
+                RAJA::expt::loop<THREAD_POLICY>(ctx, RAJA::RangeSegment(0, M), [&](int c) {
+                    working_array[c + M*r] = s_A[M - 1 - c];
+                });
+
+                // the next team index reuses the shared memory
+                ctx.teamSync();
+                ctx.releaseSharedMemory();
+
+              });  // loop r
+        });  // outer lambda
+
+  working_res.memcpy(check_array, working_array, sizeof(int) * N*M);
+
+  for (int r = 0; r < N; ++r) {
+    for (int c = 0; c < M; c++) {
+      ASSERT_EQ(M - 1 - c + M*r, check_array[c + M*r]);
+    }
+  }
+
+  deallocateForallTestData<int>(working_res,
+                               working_array,
+                               check_array,
+                               test_array);
+}
+
+
+TYPED_TEST_SUITE_P(TeamsTeamSharedMemTest);
+template <typename T>
+class TeamsTeamSharedMemTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_P(TeamsTeamSharedMemTest, TeamSharedMemTeams)
+{
+
+  using WORKING_RES = typename camp::at<TypeParam, camp::num<0>>::type;
+  using LAUNCH_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<0>>::type;
+  using TEAM_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<1>>::type;
+  using THREAD_POLICY = typename camp::at<typename camp::at<TypeParam,camp::num<1>>::type, camp::num<2>>::type;
+
+  TeamsTeamSharedMemTestImpl<WORKING_RES, LAUNCH_POLICY, TEAM_POLICY, THREAD_POLICY>();
+
+
+}
+
+REGISTER_TYPED_TEST_SUITE_P(TeamsTeamSharedMemTest,
+                            TeamSharedMemTeams);
+
+#endif  // __TEST_TEAMS_TEAM_SHARED_MEM_HPP__
@@ -102,7 +102,9 @@ using TBBForallExecPols = camp::list< RAJA::tbb_for_exec,
                                       RAJA::tbb_for_static< 2 >,
                                       RAJA::tbb_for_static< 4 >,
                                       RAJA::tbb_for_static< 8 >,
-                                      RAJA::tbb_for_dynamic >;
+                                      RAJA::tbb_for_dynamic,
+                                      RAJA::tbb_for_affinity< >,
+                                      RAJA::tbb_for_affinity< 4 > >;
 
 using TBBForallReduceExecPols = TBBForallExecPols;
 
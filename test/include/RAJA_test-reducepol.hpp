@@ -16,20 +16,21 @@
 #include "camp/list.hpp"
 
 // Sequential reduction policy types
-using SequentialReducePols = camp::list< RAJA::seq_reduce >;
+using SequentialReducePols = camp::list< RAJA::seq_reduce,
+                                         RAJA::seq_reduce_reproducible >;
 
 #if defined(RAJA_ENABLE_OPENMP)
-using OpenMPReducePols = 
-#if 0 // is ordered reduction broken???
+using OpenMPReducePols =
   camp::list< RAJA::omp_reduce,
-              RAJA::omp_reduce_ordered >;
-#else
-  camp::list< RAJA::omp_reduce >;
-#endif
+              RAJA::omp_reduce_ordered,
+              RAJA::omp_reduce_padded,
+              RAJA::omp_reduce_reproducible >;
 #endif
 
 #if defined(RAJA_ENABLE_TBB)
-using TBBReducePols = camp::list< RAJA::tbb_reduce >;
+using TBBReducePols = camp::list< RAJA::tbb_reduce,
+                                  RAJA::tbb_reduce_chunked,
+                                  RAJA::tbb_reduce_reproducible >;
 #endif
 
 #if defined(RAJA_ENABLE_TARGET_OPENMP)
@@ -43,6 +43,9 @@ using Sequential_launch_policies = camp::list<
          RAJA::expt::LoopPolicy<RAJA::loop_exec>>>;
 #endif // Sequential + device policies
 
+// the sequential launch policy gives its single team a scratchpad
+using Sequential_team_shared_launch_policies = Sequential_launch_policies;
+
 
 #if defined(RAJA_ENABLE_OPENMP)
 
@@ -77,13 +80,103 @@ using OpenMP_launch_policies = camp::list<
          RAJA::expt::LoopPolicy<RAJA::loop_exec>>>;
 #endif
 
+// host teams of OpenMP threads with shared memory and team barriers
+using OpenMP_team_shared_launch_policies = camp::list<
+        camp::list<
+#if defined(RAJA_ENABLE_CUDA)
+         RAJA::expt::LaunchPolicy<RAJA::expt::omp_team_launch_t<>,RAJA::expt::cuda_launch_t<false>>,
+         RAJA::expt::LoopPolicy<RAJA::expt::omp_team_loop, RAJA::cuda_block_x_direct>,
+         RAJA::expt::LoopPolicy<RAJA::expt::omp_team_thread_loop,RAJA::cuda_thread_x_loop>
+#elif defined(RAJA_ENABLE_HIP)
+         RAJA::expt::LaunchPolicy<RAJA::expt::omp_team_launch_t<>,RAJA::expt::hip_launch_t<false>>,
+         RAJA::expt::LoopPolicy<RAJA::expt::omp_team_loop, RAJA::hip_block_x_direct>,
+         RAJA::expt::LoopPolicy<RAJA::expt::omp_team_thread_loop,RAJA::hip_thread_x_loop>
+#else
+         RAJA::expt::LaunchPolicy<RAJA::expt::omp_team_launch_t<>>,
+         RAJA::expt::LoopPolicy<RAJA::expt::omp_team_loop>,
+         RAJA::expt::LoopPolicy<RAJA::expt::omp_team_thread_loop>
+#endif
+         >,
+        camp::list<
+#if defined(RAJA_ENABLE_CUDA)
+         RAJA::expt::LaunchPolicy<RAJA::expt::omp_team_launch_t<2>,RAJA::expt::cuda_launch_t<false>>,
+         RAJA::expt::LoopPolicy<RAJA::expt::omp_team_loop, RAJA::cuda_block_x_direct>,
+         RAJA::expt::LoopPolicy<RAJA::expt::omp_team_thread_loop,RAJA::cuda_thread_x_loop>
+#elif defined(RAJA_ENABLE_HIP)
+         RAJA::expt::LaunchPolicy<RAJA::expt::omp_team_launch_t<2>,RAJA::expt::hip_launch_t<false>>,
+         RAJA::expt::LoopPolicy<RAJA::expt::omp_team_loop, RAJA::hip_block_x_direct>,
+         RAJA::expt::LoopPolicy<RAJA::expt::omp_team_thread_loop,RAJA::hip_thread_x_loop>
+#else
+         RAJA::expt::LaunchPolicy<RAJA::expt::omp_team_launch_t<2>>,
+         RAJA::expt::LoopPolicy<RAJA::expt::omp_team_loop>,
+         RAJA::expt::LoopPolicy<RAJA::expt::omp_team_thread_loop>
+#endif
+         >>;
+
 #endif  // RAJA_ENABLE_OPENMP
 
+#if defined(RAJA_ENABLE_TBB)
+
+#if defined(RAJA_ENABLE_CUDA)
+
+using tbb_cuda_policies = camp::list<
+         RAJA::expt::LaunchPolicy<RAJA::expt::tbb_launch_t,RAJA::expt::cuda_launch_t<false>>,
+         RAJA::expt::LoopPolicy<RAJA::tbb_for_affinity<>, RAJA::cuda_block_x_direct>,
+         RAJA::expt::LoopPolicy<RAJA::loop_exec,RAJA::cuda_thread_x_loop>
+  >;
+
+using TBB_launch_policies = camp::list<
+         tbb_cuda_policies
+         >;
+
+#elif defined(RAJA_ENABLE_HIP)
+
+using tbb_hip_policies = camp::list<
+         RAJA::expt::LaunchPolicy<RAJA::expt::tbb_launch_t,RAJA::expt::hip_launch_t<false>>,
+         RAJA::expt::LoopPolicy<RAJA::tbb_for_affinity<>, RAJA::hip_block_x_direct>,
+         RAJA::expt::LoopPolicy<RAJA::loop_exec,RAJA::hip_thread_x_loop>
+  >;
+
+using TBB_launch_policies = camp::list<
+         tbb_hip_policies
+         >;
+#else
+using TBB_launch_policies = camp::list<
+        camp::list<
+         RAJA::expt::LaunchPolicy<RAJA::expt::tbb_launch_t>,
+         RAJA::expt::LoopPolicy<RAJA::tbb_for_affinity<>>,
+         RAJA::expt::LoopPolicy<RAJA::loop_exec>>,
+        camp::list<
+         RAJA::expt::LaunchPolicy<RAJA::expt::tbb_launch_t>,
+         RAJA::expt::LoopPolicy<RAJA::tbb_for_dynamic>,
+         RAJA::expt::LoopPolicy<RAJA::loop_exec>>>;
+#endif
+
+// each TBB loop policy, with the sequential loop policy to check it against
+using TBB_loop_segment_launch_policies = camp::list<
+        camp::list<
+         RAJA::expt::LaunchPolicy<RAJA::expt::tbb_launch_t>,
+         RAJA::expt::LoopPolicy<RAJA::tbb_for_dynamic>,
+         RAJA::expt::LoopPolicy<RAJA::loop_exec>>,
+        camp::list<
+         RAJA::expt::LaunchPolicy<RAJA::expt::tbb_launch_t>,
+         RAJA::expt::LoopPolicy<RAJA::tbb_for_static<4>>,
+         RAJA::expt::LoopPolicy<RAJA::loop_exec>>,
+        camp::list<
+         RAJA::expt::LaunchPolicy<RAJA::expt::tbb_launch_t>,
+         RAJA::expt::LoopPolicy<RAJA::tbb_for_affinity<>>,
+         RAJA::expt::LoopPolicy<RAJA::loop_exec>>>;
+
+#endif  // RAJA_ENABLE_TBB
+
 #if defined(RAJA_ENABLE_CUDA)
 using Cuda_launch_policies = camp::list<
          seq_cuda_policies
 #if defined(RAJA_ENABLE_OPENMP)
          , omp_cuda_policies
+#endif
+#if defined(RAJA_ENABLE_TBB)
+         , tbb_cuda_policies
 #endif
         >;
 #endif  // RAJA_ENABLE_CUDA
@@ -93,6 +186,9 @@ using Hip_launch_policies = camp::list<
          seq_hip_policies
 #if defined(RAJA_ENABLE_OPENMP)
          , omp_hip_policies
+#endif
+#if defined(RAJA_ENABLE_TBB)
+         , tbb_hip_policies
 #endif
         >;
 #endif // RAJA_ENABLE_HIP
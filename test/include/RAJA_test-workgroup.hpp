@@ -343,7 +343,12 @@ using OpenMPExecPolicyList =
                 RAJA::omp_work
               >;
 using OpenMPOrderedPolicyList = SequentialOrderedPolicyList;
-using OpenMPOrderPolicyList   = SequentialOrderPolicyList;
+using OpenMPOrderPolicyList   =
+    camp::list<
+                RAJA::ordered,
+                RAJA::reverse_ordered,
+                RAJA::unordered_omp_flattened_static
+              >;
 using OpenMPStoragePolicyList = SequentialStoragePolicyList;
 #endif
 
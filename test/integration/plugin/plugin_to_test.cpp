@@ -54,6 +54,8 @@ class CounterPlugin :
     ASSERT_EQ(data.launch_platform_active, RAJA::Platform::undefined);
     data.launch_counter_pre++;
     data.launch_platform_active = p.platform;
+    data.launch_pattern = p.pattern;
+    data.launch_num_iterations = p.num_iterations;
 
     plugin_test_resource->memcpy(plugin_test_data, &data, sizeof(CounterData));
   }
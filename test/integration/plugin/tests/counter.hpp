@@ -16,6 +16,8 @@ struct CounterData
   RAJA::Platform launch_platform_active = RAJA::Platform::undefined;
   int            launch_counter_pre     = 0;
   int            launch_counter_post    = 0;
+  RAJA::Pattern  launch_pattern         = RAJA::Pattern::undefined;
+  std::size_t    launch_num_iterations  = 0;
 };
 
 // note the use of a pointer here to allow different types of memory
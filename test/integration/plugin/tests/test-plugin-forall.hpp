@@ -45,6 +45,8 @@ void PluginForallTestImpl()
     ASSERT_EQ(loop_data.launch_platform_active, PLATFORM);
     ASSERT_EQ(loop_data.launch_counter_pre,     i+1);
     ASSERT_EQ(loop_data.launch_counter_post,    i);
+    ASSERT_EQ(loop_data.launch_pattern,         RAJA::Pattern::forall);
+    ASSERT_EQ(loop_data.launch_num_iterations,  1u);
   }
 
   CounterData plugin_data;
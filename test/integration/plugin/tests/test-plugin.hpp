@@ -41,6 +41,8 @@ struct SetupPluginVars
     data.launch_platform_active = RAJA::Platform::undefined;
     data.launch_counter_pre     = 0;
     data.launch_counter_post    = 0;
+    data.launch_pattern         = RAJA::Pattern::undefined;
+    data.launch_num_iterations  = 0;
 
     m_test_resource.memcpy(plugin_test_data, &data, sizeof(CounterData));
   }
@@ -132,6 +134,8 @@ struct PluginTestCallable
     m_data_optr[i].launch_platform_active = m_data_iptr->launch_platform_active;
     m_data_optr[i].launch_counter_pre     = m_data_iptr->launch_counter_pre;
     m_data_optr[i].launch_counter_post    = m_data_iptr->launch_counter_post;
+    m_data_optr[i].launch_pattern         = m_data_iptr->launch_pattern;
+    m_data_optr[i].launch_num_iterations  = m_data_iptr->launch_num_iterations;
   }
 
   RAJA_HOST_DEVICE void operator()(int count, int i) const
@@ -161,6 +165,8 @@ private:
     m_data.launch_platform_active = RAJA::Platform::undefined;
     m_data.launch_counter_pre     = -1;
     m_data.launch_counter_post    = -1;
+    m_data.launch_pattern         = RAJA::Pattern::undefined;
+    m_data.launch_num_iterations  = 0;
   }
 };
 
@@ -462,7 +462,21 @@ using TBBTypes = ::testing::Types<
     list<KernelPolicy<For<1, RAJA::tbb_for_exec, For<0, s, Lambda<0>>>>,
          camp::resources::Host,
          list<TypedIndex, Index_type>,
-         RAJA::tbb_reduce>>;
+         RAJA::tbb_reduce>,
+    list<KernelPolicy<
+             statement::Tile<1,
+                             tile_fixed<2>,
+                             RAJA::tbb_for_affinity<>,
+                             For<1, RAJA::loop_exec, For<0, s, Lambda<0>>>>>,
+         camp::resources::Host,
+         list<TypedIndex, Index_type>,
+         RAJA::tbb_reduce>,
+    list<KernelPolicy<statement::Collapse<RAJA::tbb_collapse_exec<>,
+                                          ArgList<0, 1>,
+                                          Lambda<0>>>,
+         camp::resources::Host,
+         list<Index_type, Index_type>,
+         RAJA::tbb_reduce_chunked>>;
 INSTANTIATE_TYPED_TEST_SUITE_P(TBB, Kernel, TBBTypes);
 #endif
 #if defined(RAJA_ENABLE_CUDA)
@@ -1413,8 +1427,205 @@ TEST(Kernel, Collapse8)
   delete[] data;
 }
 
+TEST(Kernel, Collapse9)
+{
+
+  int N = 3;
+  int M = 2;
+  int K = 4;
+  int P = 5;
+
+  int *data = new int[N * M * K * P];
+  for (int i = 0; i < N * M * K * P; ++i) {
+    data[i] = 0;
+  }
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::Collapse<RAJA::omp_parallel_collapse_exec,
+                                ArgList<0, 1, 2, 3>,
+                                Lambda<0>>>;
+
+  RAJA::kernel<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, K),
+                       RAJA::RangeSegment(0, M),
+                       RAJA::RangeSegment(0, N),
+                       RAJA::RangeSegment(0, P)),
+      [=](Index_type k, Index_type j, Index_type i, Index_type r) {
+        Index_type id = r + P * (i + N * (j + M * k));
+        data[id] += id;
+      });
+
+  for (int k = 0; k < K; ++k) {
+    for (int j = 0; j < M; ++j) {
+      for (int i = 0; i < N; ++i) {
+        for (int r = 0; r < P; ++r) {
+          Index_type id = r + P * (i + N * (j + M * k));
+          ASSERT_EQ(data[id], id);
+        }
+      }
+    }
+  }
+
+  delete[] data;
+}
+
+TEST(Kernel, Collapse10)
+{
+
+  int G = 2;
+  int D = 3;
+  int Z = 7;
+  int M = 4;
+  int Q = 2;
+
+  int *data = new int[G * D * Z * M * Q];
+  for (int i = 0; i < G * D * Z * M * Q; ++i) {
+    data[i] = 0;
+  }
+
+  // arguments are collapsed in ArgList order, not in tuple order
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::Collapse<RAJA::omp_parallel_collapse_guided_exec<2>,
+                                ArgList<2, 0, 4, 1, 3>,
+                                Lambda<0>>>;
+
+  RAJA::kernel<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, G),
+                       RAJA::RangeSegment(0, D),
+                       RAJA::RangeSegment(0, Z),
+                       RAJA::RangeSegment(0, M),
+                       RAJA::RangeSegment(0, Q)),
+      [=](Index_type g,
+          Index_type d,
+          Index_type z,
+          Index_type m,
+          Index_type q) {
+        Index_type id = q + Q * (m + M * (z + Z * (d + D * g)));
+        data[id] += 1;
+      });
+
+  for (int i = 0; i < G * D * Z * M * Q; ++i) {
+    ASSERT_EQ(data[i], 1);
+  }
+
+  delete[] data;
+}
+
+TEST(Kernel, Collapse11)
+{
+
+  int N = 1000;
+  int M = 2;
+
+  int *data = new int[N * M];
+  for (int i = 0; i < N * M; ++i) {
+    data[i] = 0;
+  }
+
+  // a single loop is spread over the threads like omp_parallel_for_exec
+  using Pol1 = RAJA::KernelPolicy<
+      RAJA::statement::Collapse<RAJA::omp_parallel_collapse_dynamic_exec<4>,
+                                ArgList<0>,
+                                Lambda<0>>>;
+
+  RAJA::kernel<Pol1>(RAJA::make_tuple(RAJA::RangeSegment(0, N)),
+                     [=](Index_type i) { data[i] += 1; });
+
+  // too few outer iterations for the threads, the inner loop is collapsed
+  using Pol2 = RAJA::KernelPolicy<
+      RAJA::statement::Collapse<RAJA::omp_parallel_collapse_static_exec<>,
+                                ArgList<1, 0>,
+                                Lambda<0>>>;
+
+  RAJA::kernel<Pol2>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, N), RAJA::RangeSegment(0, M)),
+      [=](Index_type i, Index_type j) { data[i + N * j] += 2; });
+
+  for (int j = 0; j < M; ++j) {
+    for (int i = 0; i < N; ++i) {
+      ASSERT_EQ(data[i + N * j], j == 0 ? 3 : 2);
+    }
+  }
+
+  delete[] data;
+}
+
 #endif  // RAJA_ENABLE_OPENMP
 
+#if defined(RAJA_ENABLE_TBB)
+TEST(Kernel, TBBCollapse2)
+{
+  int N = 16;
+  int M = 7;
+
+
+  int *data = new int[N * M];
+  for (int i = 0; i < M * N; ++i) {
+    data[i] = -1;
+  }
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::
+          Collapse<RAJA::tbb_collapse_exec<>, ArgList<0, 1>, Lambda<0>>>;
+
+  // run twice so the second run reuses the affinity partitioner
+  for (int rep = 0; rep < 2; ++rep) {
+    RAJA::kernel<Pol>(RAJA::make_tuple(RAJA::RangeSegment(0, N),
+                                       RAJA::RangeSegment(0, M)),
+                      [=](Index_type i, Index_type j) {
+                        data[i + j * N] = i + rep;
+                      });
+
+    for (int i = 0; i < N; ++i) {
+      for (int j = 0; j < M; ++j) {
+        ASSERT_EQ(data[i + j * N], i + rep);
+      }
+    }
+  }
+
+
+  delete[] data;
+}
+
+
+TEST(Kernel, TBBCollapse3)
+{
+  int N = 5;
+  int M = 2;
+  int K = 3;
+
+  int *data = new int[N * M * K];
+  for (int i = 0; i < M * N * K; ++i) {
+    data[i] = -1;
+  }
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::Collapse<RAJA::tbb_collapse_exec<RAJA::tbb_for_dynamic>,
+                                ArgList<0, 1, 2>,
+                                Lambda<0>>>;
+
+  RAJA::kernel<Pol>(RAJA::make_tuple(RAJA::RangeSegment(0, K),
+                                     RAJA::RangeSegment(0, M),
+                                     RAJA::RangeSegment(0, N)),
+                    [=](Index_type k, Index_type j, Index_type i) {
+                      data[i + N * (j + M * k)] = i + N * (j + M * k);
+                    });
+
+
+  for (int k = 0; k < K; k++) {
+    for (int j = 0; j < M; ++j) {
+      for (int i = 0; i < N; ++i) {
+
+        int id = i + N * (j + M * k);
+        ASSERT_EQ(data[id], id);
+      }
+    }
+  }
+
+  delete[] data;
+}
+#endif  // RAJA_ENABLE_TBB
+
 
 
 
@@ -1458,6 +1669,111 @@ TEST(Kernel, ReduceSeqSum)
 }
 
 
+#if defined(RAJA_ENABLE_OPENMP)
+
+TEST(Kernel, ReduceOmpSum)
+{
+
+  int N = 1023;
+
+  int *data = new int[N];
+  for (int i = 0; i < N; ++i) {
+    data[i] = i;
+  }
+
+  // each thread sums its iterations into its own Param, the reduce runs
+  // Lambda<1> once on the thread holding the total
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::Region<RAJA::omp_parallel_region,
+        RAJA::statement::For<0, RAJA::omp_for_nowait_static_exec< >,
+          Lambda<0, Segs<0>, Params<0>>
+        >,
+        RAJA::statement::Reduce<omp_reduce, RAJA::operators::plus, Param<0>,
+          Lambda<1, Params<0>>
+        >
+      >
+     >;
+
+  int sum = 0;
+  int calls = 0;
+  int *sumPtr = &sum;
+  int *callsPtr = &calls;
+
+  RAJA::kernel_param<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, N)),
+
+      RAJA::make_tuple((int)0),
+
+      [=](Index_type i, int &value) {
+        value += data[i];
+      },
+      [=](int &value) {
+        (*sumPtr) += value;
+        (*callsPtr) += 1;
+      });
+
+  ASSERT_EQ(sum, N*(N-1)/2);
+  ASSERT_EQ(calls, 1);
+
+  delete[] data;
+}
+
+TEST(Kernel, ReduceOmpInnerLoopMinMax)
+{
+
+  const int N = 37;
+  const int M = 211;
+
+  double *data = new double[N * M];
+  for (int i = 0; i < N * M; ++i) {
+    data[i] = (i * 7919) % 1000 - 500.0;
+  }
+  data[17 * M + 3] = -1000.0;
+  data[29 * M + 101] = 1000.0;
+
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::Region<RAJA::omp_parallel_region,
+        RAJA::statement::For<1, RAJA::omp_for_nowait_static_exec< >,
+          RAJA::statement::For<0, seq_exec,
+            Lambda<0, Segs<0, 1>, Params<0, 1>>
+          >
+        >,
+        RAJA::statement::Reduce<omp_reduce, RAJA::operators::minimum, Param<0>>,
+        RAJA::statement::Reduce<omp_reduce, RAJA::operators::maximum, Param<1>,
+          Lambda<1, Params<0, 1>>
+        >
+      >
+     >;
+
+  double min = 0.0;
+  double max = 0.0;
+  double *minPtr = &min;
+  double *maxPtr = &max;
+
+  RAJA::kernel_param<Pol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, M), RAJA::RangeSegment(0, N)),
+
+      RAJA::make_tuple(RAJA::operators::limits<double>::max(),
+                       RAJA::operators::limits<double>::min()),
+
+      [=](Index_type j, Index_type i, double &lo, double &hi) {
+        lo = RAJA_MIN(lo, data[i * M + j]);
+        hi = RAJA_MAX(hi, data[i * M + j]);
+      },
+      [=](double &lo, double &hi) {
+        *minPtr = lo;
+        *maxPtr = hi;
+      });
+
+  ASSERT_EQ(min, -1000.0);
+  ASSERT_EQ(max, 1000.0);
+
+  delete[] data;
+}
+
+#endif  // RAJA_ENABLE_OPENMP
+
+
 
 #if defined(RAJA_ENABLE_CUDA)
 
@@ -2310,6 +2626,99 @@ TEST(Kernel, Hyperplane_seq)
 }
 
 
+template <typename Pol, typename ReducePolicy>
+void Hyperplane_3d_impl()
+{
+  using namespace RAJA;
+
+  constexpr long N = (long)7;
+  constexpr long M = (long)19;
+  constexpr long O = (long)4;
+
+  std::vector<long> x(N * M * O, 0);
+  long *x_ptr = x.data();
+
+  RAJA::ReduceSum<ReducePolicy, long> trip_count(0);
+  RAJA::ReduceSum<ReducePolicy, long> oob_count(0);
+
+  kernel<Pol>(
+      RAJA::make_tuple(RangeSegment(0, N),
+                       RangeStrideSegment(M - 1, -1, -1),
+                       RangeSegment(0, O)),
+      [=](Index_type i, Index_type j, Index_type k) {
+        if (i < 0 || i >= N || j < 0 || j >= M || k < 0 || k >= O) {
+          oob_count += 1;
+          return;
+        }
+
+        long left = (i > 0) ? x_ptr[((i - 1) * M + j) * O + k] : 1;
+        long down = (j < M - 1) ? x_ptr[(i * M + j + 1) * O + k] : 1;
+        long back = (k > 0) ? x_ptr[(i * M + j) * O + k - 1] : 1;
+
+        x_ptr[(i * M + j) * O + k] = left + down + back;
+
+        trip_count += 1;
+      });
+
+  ASSERT_EQ((long)trip_count, N * M * O);
+  ASSERT_EQ((long)oob_count, (long)0);
+
+  std::vector<long> y(N * M * O, 0);
+  for (long i = 0; i < N; ++i) {
+    for (long j = M - 1; j >= 0; --j) {
+      for (long k = 0; k < O; ++k) {
+        long left = (i > 0) ? y[((i - 1) * M + j) * O + k] : 1;
+        long down = (j < M - 1) ? y[(i * M + j + 1) * O + k] : 1;
+        long back = (k > 0) ? y[(i * M + j) * O + k - 1] : 1;
+        y[(i * M + j) * O + k] = left + down + back;
+      }
+    }
+  }
+
+  for (long i = 0; i < N * M * O; ++i) {
+    ASSERT_EQ(x[i], y[i]);
+  }
+}
+
+template <typename HpExecPolicy, typename ExecPolicy>
+using HyperplaneExact_3d_pol = RAJA::KernelPolicy<
+    RAJA::statement::HyperplaneExact<0, HpExecPolicy, RAJA::ArgList<1, 2>,
+                                     ExecPolicy, RAJA::statement::Lambda<0>>>;
+
+TEST(Kernel, HyperplaneExact_seq)
+{
+  Hyperplane_3d_impl<HyperplaneExact_3d_pol<RAJA::seq_exec, RAJA::seq_exec>,
+                     RAJA::seq_reduce>();
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(Kernel, HyperplaneExact_omp)
+{
+  Hyperplane_3d_impl<
+      HyperplaneExact_3d_pol<RAJA::seq_exec, RAJA::omp_parallel_for_exec>,
+      RAJA::omp_reduce>();
+}
+
+TEST(Kernel, HyperplaneExact_omp_wavefront)
+{
+  Hyperplane_3d_impl<
+      HyperplaneExact_3d_pol<RAJA::omp_parallel_wavefront_exec<4>,
+                             RAJA::seq_exec>,
+      RAJA::omp_reduce>();
+}
+
+TEST(Kernel, Hyperplane_omp_wavefront)
+{
+  using Pol = RAJA::KernelPolicy<
+      RAJA::statement::Hyperplane<0, RAJA::omp_parallel_wavefront_exec<3>,
+                                  RAJA::ArgList<1, 2>, RAJA::seq_exec,
+                                  RAJA::statement::Lambda<0>>>;
+
+  Hyperplane_3d_impl<Pol, RAJA::omp_reduce>();
+}
+#endif
+
+
 #if defined(RAJA_ENABLE_CUDA)
 
 
@@ -0,0 +1,44 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Header file containing sort tests with lengths large enough that host
+/// radix sorts split each pass into several parts
+///
+
+#ifndef __TEST_ALGORITHM_SORT_LARGE_HPP__
+#define __TEST_ALGORITHM_SORT_LARGE_HPP__
+
+#include "test-algorithm-sort-utils.hpp"
+
+TYPED_TEST_SUITE_P(SortLargeUnitTest);
+
+template < typename T >
+class SortLargeUnitTest : public ::testing::Test
+{ };
+
+TYPED_TEST_P(SortLargeUnitTest, UnitSortLarge)
+{
+  using Sorter   = typename camp::at<TypeParam, camp::num<0>>::type;
+  using ResType  = typename camp::at<TypeParam, camp::num<1>>::type;
+  using KeyType  = typename camp::at<TypeParam, camp::num<2>>::type;
+
+  unsigned seed = get_random_seed();
+  Sorter sorter{};
+  ResType res = ResType::get_default();
+
+  const RAJA::Index_type part = static_cast<RAJA::Index_type>(
+      RAJA::detail::radix_sort_min_items_per_part());
+
+  // two whole parts, then several parts with a partial last part
+  testSorterDuplicateKeys<KeyType>(seed, 2 * part, sorter, res);
+  testSorterDuplicateKeys<KeyType>(seed, 5 * part + 777, sorter, res);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(SortLargeUnitTest, UnitSortLarge);
+
+#endif //__TEST_ALGORITHM_SORT_LARGE_HPP__
@@ -642,6 +642,31 @@ void testSorter(unsigned seed, RAJA::Index_type MaxN, Sorter sorter, Res res)
   }
 }
 
+template <typename K,
+          typename Sorter,
+          typename Res>
+void testSorterDuplicateKeys(unsigned seed, RAJA::Index_type N, Sorter sorter, Res res)
+{
+  using stability_category = typename Sorter::sort_category ;
+  using pairs_category     = typename Sorter::sort_interface ;
+  using no_comparator      = sort_default_interface_tag;
+  using use_comparator     = sort_comp_interface_tag;
+
+  // few distinct keys, so stable sorts must keep long runs of equal keys in
+  // order across the parts of a parallel sort
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<RAJA::Index_type> dist(0, 100);
+
+  SortData<Res, pairs_category, K> data(N, res, [&](){ return dist(rng); });
+
+  ASSERT_TRUE(testSort("default", seed, data, N, RAJA::operators::less<K>{},
+      sorter, stability_category{}, pairs_category{}, no_comparator{}));
+  ASSERT_TRUE(testSort("ascending", seed, data, N, RAJA::operators::less<K>{},
+      sorter, stability_category{}, pairs_category{}, use_comparator{}));
+  ASSERT_TRUE(testSort("descending", seed, data, N, RAJA::operators::greater<K>{},
+      sorter, stability_category{}, pairs_category{}, use_comparator{}));
+}
+
 inline unsigned get_random_seed()
 {
   static unsigned seed = std::random_device{}();
@@ -21,6 +21,7 @@
 #define __TEST_UNIT_ALGORITHM_STABLE_SORT_HPP__
 
 #include "test-algorithm-sort-utils.hpp"
+#include "test-algorithm-sort-large.hpp"
 
 
 template < typename policy >
@@ -13,6 +13,10 @@
 
 #include "camp/resource.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
 //
 // Resource object used to construct list segment objects with indices
 // living in host (CPU) memory. Used in all tests.
@@ -224,3 +228,183 @@ TEST(IndexSetUnitTest, ConditionalLessThan100Indices)
     EXPECT_EQ(lt100_indices[i], ref_lt100_indices[i]);
   }
 }
+
+TEST(IndexSetUnitTest, PushMovesTemporaries)
+{
+  using ListSegType = RAJA::TypedListSegment<int>;
+  using RangeSegType = RAJA::TypedRangeSegment<int>;
+  RAJA::TypedIndexSet<RangeSegType, ListSegType> iset;
+
+  int idx[] = {0, 2, 4, 5};
+  ListSegType lseg(idx, 4, host_res);
+  const int* lseg_data = lseg.begin();
+
+  // the index set takes over the segment's index data without copying it
+  iset.push_back(std::move(lseg));
+  ASSERT_EQ(lseg_data, iset.getSegment<const ListSegType>(0).begin());
+  ASSERT_EQ(RAJA::Owned,
+            iset.getSegment<const ListSegType>(0).getIndexOwnership());
+
+  // an unowned segment stays a view of the caller's array
+  iset.push_front(ListSegType(idx, 2, host_res, RAJA::Unowned));
+  ASSERT_EQ(idx, iset.getSegment<const ListSegType>(0).begin());
+  ASSERT_EQ(size_t(6), iset.getLength());
+
+  // a const temporary can not be moved from and is copied instead
+  auto make_const_range = []() -> const RangeSegType {
+    return RangeSegType(10, 12);
+  };
+  iset.push_back(make_const_range());
+  iset.push_front(make_const_range());
+  ASSERT_EQ(size_t(10), iset.getLength());
+}
+
+TEST(IndexSetUnitTest, DependencyGraph)
+{
+  using RangeSegType = RAJA::TypedRangeSegment<int>;
+  using RIndexSetType = RAJA::TypedIndexSet<RangeSegType>;
+  RIndexSetType iset;
+
+  iset.push_back(RangeSegType(0, 4));
+  iset.push_back(RangeSegType(4, 8));
+  ASSERT_FALSE(iset.dependencyGraphSet());
+
+  iset.initDependencyGraph();
+  ASSERT_TRUE(iset.dependencyGraphSet());
+
+  // more dependent tasks than the old fixed limit of 8
+  RAJA::DepGraphNode* task = iset.getDepGraphNode(0);
+  for (int i = 0; i < 16; ++i) {
+    task->addDepTask(1);
+  }
+  ASSERT_EQ(16, task->numDepTasks());
+  iset.finalizeDependencyGraph();
+
+  RAJA::DepGraphNode* dep = iset.getDepGraphNode(1);
+  dep->semaphoreReloadValue() = 2;
+  dep->reset();
+  ASSERT_EQ(2, dep->semaphoreValue().load());
+  dep->satisfyOne();
+  dep->satisfyOne();
+  dep->satisfyOne();
+  ASSERT_EQ(0, dep->semaphoreValue().load());
+  dep->wait();
+
+  // copies share the dependency graph
+  RIndexSetType iset2(iset);
+  ASSERT_TRUE(iset2.dependencyGraphSet());
+  ASSERT_EQ(task, iset2.getDepGraphNode(0));
+
+  // adding a segment invalidates the graph
+  iset.push_back(RangeSegType(8, 12));
+  ASSERT_FALSE(iset.dependencyGraphSet());
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(IndexSetUnitTest, LockFreeBlockTaskgraph)
+{
+  RAJA::TypedIndexSet<RAJA::RangeSegment> iset;
+
+  const int fastDim = 4;
+  const int midDim = 4;
+  const int slowDim = 4 * omp_get_max_threads();
+  const int len = fastDim * midDim * slowDim;
+  RAJA::buildLockFreeBlockIndexset(iset, fastDim, midDim, slowDim);
+
+  ASSERT_TRUE(iset.dependencyGraphSet());
+  ASSERT_EQ(len, static_cast<int>(iset.getLength()));
+
+  std::vector<int> count(len, 0);
+  int* count_ptr = count.data();
+
+  using TaskgraphPolicy =
+      RAJA::ExecPolicy<RAJA::omp_taskgraph_segit, RAJA::seq_exec>;
+
+  for (int sweep = 0; sweep < 3; ++sweep) {
+    RAJA::forall<TaskgraphPolicy>(iset, [=](RAJA::Index_type i) {
+      count_ptr[i] += 1;
+    });
+  }
+
+  for (int i = 0; i < len; ++i) {
+    ASSERT_EQ(3, count[i]);
+  }
+}
+
+//
+// Builds an index set whose segment s depends on segments s / 2 and s - 3,
+// runs it with the given taskgraph policy, and checks that every element
+// of a segment finished after all elements of the segments it depends on.
+//
+template <typename TaskgraphPolicy>
+void testTaskgraphOrder()
+{
+  using RangeSegType = RAJA::TypedRangeSegment<int>;
+
+  const int seg_len = 8;
+  const int num_seg = 8 * omp_get_max_threads() + 3;
+  const int len = num_seg * seg_len;
+
+  RAJA::TypedIndexSet<RangeSegType> iset;
+  for (int s = 0; s < num_seg; ++s) {
+    iset.push_back(RangeSegType(s * seg_len, (s + 1) * seg_len));
+  }
+
+  std::vector<std::vector<int>> preds(num_seg);
+  for (int s = 1; s < num_seg; ++s) {
+    preds[s].push_back(s / 2);
+    if (s >= 3 && s - 3 != s / 2) {
+      preds[s].push_back(s - 3);
+    }
+  }
+
+  iset.initDependencyGraph();
+  for (int s = 0; s < num_seg; ++s) {
+    RAJA::DepGraphNode* task = iset.getDepGraphNode(s);
+    task->semaphoreReloadValue() = static_cast<int>(preds[s].size());
+    task->reset();
+    for (int p : preds[s]) {
+      iset.getDepGraphNode(p)->addDepTask(s);
+    }
+  }
+  iset.finalizeDependencyGraph();
+
+  std::atomic<int> clock(0);
+  std::atomic<int>* clock_ptr = &clock;
+  std::vector<int> tick(len);
+  int* tick_ptr = tick.data();
+
+  for (int sweep = 0; sweep < 3; ++sweep) {
+    clock = 0;
+    RAJA::forall<TaskgraphPolicy>(iset, [=](RAJA::Index_type i) {
+      tick_ptr[i] = clock_ptr->fetch_add(1);
+    });
+
+    ASSERT_EQ(len, clock.load());
+    for (int s = 0; s < num_seg; ++s) {
+      for (int p : preds[s]) {
+        int last_pred = -1;
+        for (int i = p * seg_len; i < (p + 1) * seg_len; ++i) {
+          last_pred = std::max(last_pred, tick[i]);
+        }
+        for (int i = s * seg_len; i < (s + 1) * seg_len; ++i) {
+          ASSERT_GT(tick[i], last_pred)
+              << "segment " << s << " ran before segment " << p;
+        }
+      }
+    }
+  }
+}
+
+TEST(IndexSetUnitTest, TaskgraphOrder)
+{
+  testTaskgraphOrder<
+      RAJA::ExecPolicy<RAJA::omp_taskgraph_segit, RAJA::seq_exec>>();
+}
+
+TEST(IndexSetUnitTest, TaskgraphIntervalOrder)
+{
+  testTaskgraphOrder<
+      RAJA::ExecPolicy<RAJA::omp_taskgraph_interval_segit, RAJA::seq_exec>>();
+}
+#endif
@@ -100,3 +100,30 @@ TYPED_TEST(ListSegmentUnitTest, Iterators)
   ASSERT_EQ(4, list.size());
 }
 
+
+TYPED_TEST(ListSegmentUnitTest, Ownership)
+{
+  std::vector<TypeParam> idx{5,3,1,2};
+
+  RAJA::TypedListSegment<TypeParam> owned( idx, host_res, RAJA::Owned );
+  ASSERT_EQ(RAJA::Owned, owned.getIndexOwnership());
+  ASSERT_NE(idx.data(), owned.begin());
+  ASSERT_EQ(owned.indicesEqual( idx.data(), idx.size() ), true);
+
+  // an unowned segment and its copies use the caller's array in place
+  RAJA::TypedListSegment<TypeParam> view( idx, host_res, RAJA::Unowned );
+  ASSERT_EQ(RAJA::Unowned, view.getIndexOwnership());
+  ASSERT_EQ(idx.data(), view.begin());
+  ASSERT_EQ(4, view.size());
+
+  RAJA::TypedListSegment<TypeParam> copied(view);
+  ASSERT_EQ(RAJA::Unowned, copied.getIndexOwnership());
+  ASSERT_EQ(idx.data(), copied.begin());
+
+  idx[0] = 7;
+  ASSERT_EQ(TypeParam(7), *view.begin());
+
+  std::vector<TypeParam> empty;
+  RAJA::TypedListSegment<TypeParam> empty_view( empty, host_res, RAJA::Unowned );
+  ASSERT_EQ(0, empty_view.size());
+}
@@ -0,0 +1,89 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the loop patterns tbb_reduce_chunked
+/// supports, and the TBB reducer to use in teams launch loops instead.
+///
+
+#include "test-reducer.hpp"
+
+template <typename ExecPolicy>
+void testChunkedForallSum()
+{
+  constexpr long N = 100000;
+
+  RAJA::ReduceSum<RAJA::tbb_reduce_chunked, long> sum(0);
+
+  RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, N),
+                           [=](RAJA::Index_type i) { sum += i; });
+
+  ASSERT_EQ(sum.get(), N * (N - 1) / 2);
+}
+
+// forall policies give every chunk its own copy of the loop body
+TEST(ReducerChunkedTBBUnitTest, Forall)
+{
+  testChunkedForallSum<RAJA::tbb_for_dynamic>();
+  testChunkedForallSum<RAJA::tbb_for_static<8>>();
+  testChunkedForallSum<RAJA::tbb_for_affinity<4>>();
+}
+
+// kernel policies give every chunk its own copy of the loop data
+TEST(ReducerChunkedTBBUnitTest, Kernel)
+{
+  constexpr long N = 300;
+  constexpr long M = 200;
+  constexpr long expected = M * N * (N - 1) / 2 + N * M * (M - 1) / 2;
+
+  using CollapsePol = RAJA::KernelPolicy<
+      RAJA::statement::Collapse<RAJA::tbb_collapse_exec<>,
+                                RAJA::ArgList<0, 1>,
+                                RAJA::statement::Lambda<0>>>;
+
+  using ForPol = RAJA::KernelPolicy<
+      RAJA::statement::For<1, RAJA::tbb_for_affinity<>,
+        RAJA::statement::For<0, RAJA::loop_exec,
+          RAJA::statement::Lambda<0>>>>;
+
+  RAJA::ReduceSum<RAJA::tbb_reduce_chunked, long> collapse_sum(0);
+  RAJA::kernel<CollapsePol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, N), RAJA::RangeSegment(0, M)),
+      [=](RAJA::Index_type i, RAJA::Index_type j) { collapse_sum += i + j; });
+  ASSERT_EQ(collapse_sum.get(), expected);
+
+  RAJA::ReduceSum<RAJA::tbb_reduce_chunked, long> for_sum(0);
+  RAJA::kernel<ForPol>(
+      RAJA::make_tuple(RAJA::RangeSegment(0, N), RAJA::RangeSegment(0, M)),
+      [=](RAJA::Index_type i, RAJA::Index_type j) { for_sum += i + j; });
+  ASSERT_EQ(for_sum.get(), expected);
+}
+
+// teams loop bodies capture the reducer by reference, so privatizing them
+// shares one reducer copy between chunks; these loops use tbb_reduce
+TEST(ReducerChunkedTBBUnitTest, LaunchUsesTBBReduce)
+{
+  constexpr int N = 1000;
+
+  using launch_policy =
+      RAJA::expt::LaunchPolicy<RAJA::expt::tbb_launch_t>;
+  using loop_policy = RAJA::expt::LoopPolicy<RAJA::tbb_for_affinity<>>;
+
+  RAJA::ReduceSum<RAJA::tbb_reduce, long> sum(0);
+
+  RAJA::expt::launch<launch_policy>(
+      RAJA::expt::HOST,
+      RAJA::expt::Resources(RAJA::expt::Teams(N), RAJA::expt::Threads(N)),
+      [=](RAJA::expt::LaunchContext ctx) {
+        RAJA::expt::loop<loop_policy>(ctx,
+                                      RAJA::RangeSegment(0, N),
+                                      RAJA::RangeSegment(0, N),
+                                      [&](int i, int j) { sum += i + j; });
+      });
+
+  ASSERT_EQ(sum.get(), long(N) * N * (N - 1));
+}
@@ -0,0 +1,62 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for RAJA OpenMP reducers used in loops
+/// nested inside another parallel region.
+///
+
+#include "test-reducer.hpp"
+
+#include <omp.h>
+
+template <typename T>
+class ReducerNestedOpenMPUnitTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE(ReducerNestedOpenMPUnitTest,
+                 Test<OpenMPReducerPolicyList>::Types);
+
+TYPED_TEST(ReducerNestedOpenMPUnitTest, InactiveNestedRegion)
+{
+  using ReducePolicy = TypeParam;
+
+  constexpr long N = 100;
+  constexpr long loop_sum = N * (N - 1) / 2;
+  constexpr int num_loops = 500;
+
+  // with nesting disabled the inner forall regions are inactive, so all of
+  // their threads have thread number 0 and must not share one slot
+  const int max_levels = omp_get_max_active_levels();
+  omp_set_max_active_levels(1);
+
+  RAJA::ReduceSum<ReducePolicy, long> shared_sum(0);
+  int num_outer = 0;
+
+#pragma omp parallel num_threads(4)
+  {
+#pragma omp atomic
+    ++num_outer;
+
+    RAJA::ReduceSum<ReducePolicy, long> own_sum(0);
+
+    for (int l = 0; l < num_loops; ++l) {
+      RAJA::forall<RAJA::omp_parallel_for_exec>(RAJA::RangeSegment(0, N),
+                                                [=](RAJA::Index_type i) {
+                                                  shared_sum += i;
+                                                  own_sum += i;
+                                                });
+    }
+
+    EXPECT_EQ(own_sum.get(), num_loops * loop_sum);
+  }
+
+  omp_set_max_active_levels(max_levels);
+
+  ASSERT_EQ(shared_sum.get(), num_outer * num_loops * loop_sum);
+}
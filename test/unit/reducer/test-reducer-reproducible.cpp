@@ -0,0 +1,264 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing tests for the reproducible sum reducers: exact
+/// rounding of sums with a wide dynamic range, and bitwise identical results
+/// for any number of threads and loop schedule.
+///
+
+#include "test-reducer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+#if defined(RAJA_ENABLE_OPENMP)
+#include <omp.h>
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+#include <tbb/task_arena.h>
+#endif
+
+namespace
+{
+
+std::uint64_t toBits(double val)
+{
+  std::uint64_t bits;
+  std::memcpy(&bits, &val, sizeof(bits));
+  return bits;
+}
+
+// a double with a random 53 bit mantissa and sign, at 2^exponent
+double randomValue(std::mt19937_64& gen, int exponent)
+{
+  std::uint64_t mantissa = (gen() >> 11) | (std::uint64_t(1) << 52);
+  double val = std::ldexp(static_cast<double>(mantissa), exponent - 52);
+  return (gen() & 1) ? -val : val;
+}
+
+// pairs of opposite values from 2^-1074 to 2^1000 whose exact sum is 0
+std::vector<double> cancellingData(std::mt19937_64& gen, int numPairs)
+{
+  std::uniform_int_distribution<int> exponent(-1074, 1000);
+  std::vector<double> data;
+  for (int i = 0; i < numPairs; ++i) {
+    double val = randomValue(gen, exponent(gen));
+    data.push_back(val);
+    data.push_back(-val);
+  }
+  // subnormals, with all of the mantissa bits set
+  for (int i = 0; i < numPairs / 8; ++i) {
+    double val = std::ldexp(static_cast<double>(gen() >> 12), -1074);
+    data.push_back(val);
+    data.push_back(-val);
+  }
+  return data;
+}
+
+// cancelling data plus unmatched values of every magnitude and sign
+std::vector<double> wideRangeData()
+{
+  std::mt19937_64 gen(20210601);
+  std::vector<double> data = cancellingData(gen, 20000);
+  std::uniform_int_distribution<int> exponent(-1074, 1000);
+  for (int i = 0; i < 5000; ++i) {
+    data.push_back(randomValue(gen, exponent(gen)));
+  }
+  for (int i = 0; i < 500; ++i) {
+    data.push_back(randomValue(gen, exponent(gen) / 32));
+  }
+  std::shuffle(data.begin(), data.end(), gen);
+  return data;
+}
+
+template <typename ExecPolicy, typename ReducePolicy>
+double reproducibleSum(std::vector<double> const& data)
+{
+  const double* d = data.data();
+  RAJA::ReduceSum<ReducePolicy, double> sum(0.0);
+  RAJA::forall<ExecPolicy>(RAJA::RangeSegment(0, data.size()),
+                           [=](RAJA::Index_type i) { sum += d[i]; });
+  return sum.get();
+}
+
+double sequentialSum(std::vector<double> const& data)
+{
+  return reproducibleSum<RAJA::seq_exec, RAJA::seq_reduce_reproducible>(data);
+}
+
+// data with its exact sum appended, shuffled into the cancelling data
+void checkExactSum(std::vector<double> data, double expected)
+{
+  std::mt19937_64 gen(data.size());
+  std::vector<double> all = cancellingData(gen, 2000);
+  all.insert(all.end(), data.begin(), data.end());
+  std::shuffle(all.begin(), all.end(), gen);
+
+  ASSERT_EQ(toBits(sequentialSum(all)), toBits(expected))
+      << "expected " << expected;
+}
+
+}  // namespace
+
+TEST(ReducerReproducibleUnitTest, ExactSums)
+{
+  // everything cancels
+  checkExactSum({}, 0.0);
+
+  // carries from the lowest limbs into the mantissa of the result
+  std::vector<double> ones_and_tiny(1024, std::ldexp(1.0, -60));
+  ones_and_tiny.push_back(1.0);
+  checkExactSum(ones_and_tiny, 1.0 + std::ldexp(1.0, -50));
+
+  // the same with borrows through negative limbs
+  for (double& val : ones_and_tiny) {
+    val = -val;
+  }
+  checkExactSum(ones_and_tiny, -(1.0 + std::ldexp(1.0, -50)));
+
+  // a tie rounds to even, one bit far below breaks the tie
+  checkExactSum({1.0, std::ldexp(1.0, -53)}, 1.0);
+  checkExactSum({1.0, std::ldexp(1.0, -53), std::ldexp(1.0, -1074)},
+                1.0 + std::ldexp(1.0, -52));
+  checkExactSum({1.0, std::ldexp(1.0, -53), -std::ldexp(1.0, -1074)}, 1.0);
+
+  // subnormal and largest finite magnitudes
+  checkExactSum({std::ldexp(1.0, -1074),
+                 std::ldexp(1.0, -1074),
+                 std::ldexp(1.0, -1074)},
+                std::ldexp(3.0, -1074));
+  checkExactSum({std::numeric_limits<double>::max(),
+                 std::ldexp(1.0, -1074),
+                 -std::numeric_limits<double>::max()},
+                std::ldexp(1.0, -1074));
+  checkExactSum({std::ldexp(1.0, 1023), std::ldexp(1.0, 1022),
+                 -std::ldexp(1.0, 1023), std::ldexp(-1.0, -1000)},
+                std::ldexp(1.0, 1022));
+
+  // 2^20 copies of 1 - 2^-53 add up to 2^20 - 2^-33, which is a double
+  checkExactSum(std::vector<double>(1 << 20, 1.0 - std::ldexp(1.0, -53)),
+                std::ldexp(1.0, 20) - std::ldexp(1.0, -33));
+}
+
+// float sums are rounded once from the exact sum, not through double
+TEST(ReducerReproducibleUnitTest, ExactFloatSums)
+{
+  auto floatSum = [](std::vector<float> const& data) {
+    const float* d = data.data();
+    RAJA::ReduceSum<RAJA::seq_reduce_reproducible, float> sum(0.0f);
+    RAJA::forall<RAJA::seq_exec>(RAJA::RangeSegment(0, data.size()),
+                                 [=](RAJA::Index_type i) { sum += d[i]; });
+    return static_cast<float>(sum.get());
+  };
+
+  const float one_up = 1.0f + std::ldexp(1.0f, -23);
+
+  // 1 + 2^-24 + 2^-80 is a tie broken by a bit double does not keep
+  ASSERT_EQ(floatSum({1.0f, std::ldexp(1.0f, -24), std::ldexp(1.0f, -80)}),
+            one_up);
+  ASSERT_EQ(floatSum({-1.0f, -std::ldexp(1.0f, -24), -std::ldexp(1.0f, -80)}),
+            -one_up);
+  ASSERT_EQ(floatSum({1.0f, std::ldexp(1.0f, -24)}), 1.0f);
+  ASSERT_EQ(floatSum({1.0f, std::ldexp(1.0f, -24), -std::ldexp(1.0f, -80)}),
+            1.0f);
+
+  // intermediate sums beyond the float range
+  const float big = std::numeric_limits<float>::max();
+  ASSERT_EQ(floatSum({big, big, 1.0f, -big}), big);
+}
+
+// integer multiples of powers of two, so the exact sum is an integer
+TEST(ReducerReproducibleUnitTest, ExactIntegerScaledSum)
+{
+  std::mt19937_64 gen(4242);
+  std::uniform_int_distribution<std::int64_t> digits(-(1 << 16), 1 << 16);
+  std::uniform_int_distribution<int> scale(0, 60);
+
+  // the exact sum in units of 2^-30, as high * 2^32 + low
+  std::vector<double> data;
+  std::int64_t high = 0;
+  std::int64_t low = 0;
+  for (int i = 0; i < (1 << 12); ++i) {
+    std::int64_t n = digits(gen);
+    int s = scale(gen);
+    if (s < 32) {
+      low += n * (std::int64_t(1) << s);
+    } else {
+      high += n * (std::int64_t(1) << (s - 32));
+    }
+    data.push_back(std::ldexp(static_cast<double>(n), s - 30));
+  }
+  high += low >> 32;
+  low &= (std::int64_t(1) << 32) - 1;
+
+  // both parts are exact doubles, so their sum is rounded once
+  ASSERT_LT(std::abs(high), std::int64_t(1) << 53);
+  checkExactSum(data,
+                std::ldexp(static_cast<double>(high), 2) +
+                    std::ldexp(static_cast<double>(low), -30));
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(ReducerReproducibleUnitTest, OpenMPMatchesSequential)
+{
+  const std::vector<double> data = wideRangeData();
+  const std::uint64_t expected = toBits(sequentialSum(data));
+
+  const int max_threads = omp_get_max_threads();
+  for (int num_threads : {1, 2, max_threads}) {
+    omp_set_num_threads(num_threads);
+
+    EXPECT_EQ(toBits(reproducibleSum<RAJA::omp_parallel_for_static_exec<>,
+                                     RAJA::omp_reduce_reproducible>(data)),
+              expected)
+        << num_threads << " threads, static";
+    EXPECT_EQ(toBits(reproducibleSum<RAJA::omp_parallel_for_static_exec<7>,
+                                     RAJA::omp_reduce_reproducible>(data)),
+              expected)
+        << num_threads << " threads, static chunks of 7";
+    EXPECT_EQ(toBits(reproducibleSum<RAJA::omp_parallel_for_dynamic_exec<16>,
+                                     RAJA::omp_reduce_reproducible>(data)),
+              expected)
+        << num_threads << " threads, dynamic";
+  }
+  omp_set_num_threads(max_threads);
+}
+#endif
+
+#if defined(RAJA_ENABLE_TBB)
+TEST(ReducerReproducibleUnitTest, TBBMatchesSequential)
+{
+  const std::vector<double> data = wideRangeData();
+  const std::uint64_t expected = toBits(sequentialSum(data));
+
+  for (int num_threads : {1, 2, int(tbb::task_arena::automatic)}) {
+    tbb::task_arena arena(num_threads);
+    arena.execute([&] {
+      EXPECT_EQ(toBits(reproducibleSum<RAJA::tbb_for_dynamic,
+                                       RAJA::tbb_reduce_reproducible>(data)),
+                expected)
+          << "arena " << num_threads << ", dynamic";
+      EXPECT_EQ(toBits(reproducibleSum<RAJA::tbb_for_static<8>,
+                                       RAJA::tbb_reduce_reproducible>(data)),
+                expected)
+          << "arena " << num_threads << ", static";
+      EXPECT_EQ(toBits(reproducibleSum<RAJA::tbb_for_affinity<>,
+                                       RAJA::tbb_reduce_reproducible>(data)),
+                expected)
+          << "arena " << num_threads << ", affinity";
+    });
+  }
+}
+#endif
@@ -0,0 +1,185 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for basic_mempool
+///
+
+#include "RAJA_test-base.hpp"
+
+#include "RAJA/util/basic_mempool.hpp"
+
+#include <cstdint>
+#include <map>
+#include <random>
+#include <vector>
+
+using test_mempool_type =
+    RAJA::basic_mempool::MemPool<RAJA::basic_mempool::generic_allocator>;
+
+using test_arena_type = RAJA::basic_mempool::detail::MemoryArena;
+
+TEST(BasicMemPoolUnitTest, MemoryArenaCoalescing)
+{
+  const size_t chunk = 1000;
+  const size_t nchunks = 64;
+  std::vector<char> memory(chunk * nchunks);
+  test_arena_type arena(memory.data(), memory.size());
+
+  std::vector<void*> ptrs;
+  for (size_t i = 0; i < nchunks; ++i) {
+    void* ptr = arena.get(chunk, 1);
+    ASSERT_EQ(ptr, memory.data() + i * chunk);
+    ptrs.push_back(ptr);
+  }
+  ASSERT_EQ(arena.get(1, 1), nullptr);
+
+  // freeing every other chunk leaves no room for two chunks in a row
+  for (size_t i = 0; i < nchunks; i += 2) {
+    ASSERT_TRUE(arena.give(ptrs[i]));
+  }
+  ASSERT_EQ(arena.get(2 * chunk, 1), nullptr);
+
+  // freeing the rest merges everything back into one chunk, in any order
+  for (size_t i = nchunks - 1; i < nchunks; i -= 2) {
+    ASSERT_TRUE(arena.give(ptrs[i]));
+  }
+  ASSERT_TRUE(arena.unused());
+
+  void* whole = arena.get(memory.size(), 1);
+  ASSERT_EQ(whole, memory.data());
+  ASSERT_TRUE(arena.give(whole));
+
+  ASSERT_FALSE(arena.give(memory.data() + memory.size()));
+}
+
+TEST(BasicMemPoolUnitTest, MemoryArenaFragmentation)
+{
+  std::vector<char> memory(size_t(1) << 22);
+  char* begin = memory.data();
+  char* end = begin + memory.size();
+  test_arena_type arena(begin, memory.size());
+
+  std::mt19937 gen(12345);
+  std::map<char*, size_t> live;
+
+  for (int i = 0; i < 100000; ++i) {
+    if (live.empty() || (live.size() < 1000 && gen() % 3 != 0)) {
+      const size_t len = 1 + gen() % ((gen() % 4 == 0) ? 20000 : 200);
+      const size_t alignment = size_t(1) << (gen() % 12);
+      char* ptr = static_cast<char*>(arena.get(len, alignment));
+      ASSERT_NE(ptr, nullptr);
+      ASSERT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % alignment, 0u);
+      ASSERT_TRUE(begin <= ptr && ptr + len <= end);
+
+      // must not overlap the live chunks on either side
+      auto next = live.lower_bound(ptr);
+      if (next != live.end()) {
+        ASSERT_LE(ptr + len, next->first);
+      }
+      if (next != live.begin()) {
+        auto prev = std::prev(next);
+        ASSERT_LE(prev->first + prev->second, ptr);
+      }
+      live.emplace(ptr, len);
+    } else {
+      auto iter = live.begin();
+      std::advance(iter, gen() % live.size());
+      ASSERT_TRUE(arena.give(iter->first));
+      live.erase(iter);
+    }
+  }
+
+  for (auto const& chunk : live) {
+    ASSERT_TRUE(arena.give(chunk.first));
+  }
+  ASSERT_TRUE(arena.unused());
+
+  void* whole = arena.get(memory.size(), 1);
+  ASSERT_EQ(whole, begin);
+  ASSERT_TRUE(arena.give(whole));
+}
+
+TEST(BasicMemPoolUnitTest, ThreadCacheReuse)
+{
+  test_mempool_type pool;
+  ASSERT_TRUE(pool.thread_caches());
+
+  double* a = pool.malloc<double>(3);
+  ASSERT_NE(a, nullptr);
+  pool.free(a);
+
+  // a freed block is handed out again for the same size class
+  double* b = pool.malloc<double>(4);
+  ASSERT_EQ(a, b);
+  pool.free(b);
+
+  pool.free_chunks();
+}
+
+TEST(BasicMemPoolUnitTest, Alignment)
+{
+  test_mempool_type pool;
+
+  for (int cache = 0; cache < 2; ++cache) {
+    pool.thread_caches(cache != 0);
+    std::vector<char*> ptrs;
+    for (size_t alignment = 1; alignment <= 8192; alignment *= 2) {
+      for (size_t len = 1; len <= 10000; len = len * 3 + 1) {
+        char* ptr = pool.malloc<char>(len, alignment);
+        ASSERT_NE(ptr, nullptr);
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % alignment, 0u);
+        for (size_t i = 0; i < len; ++i) {
+          ptr[i] = static_cast<char>(i);
+        }
+        ptrs.push_back(ptr);
+      }
+    }
+    for (char* ptr : ptrs) {
+      pool.free(ptr);
+    }
+  }
+
+  pool.free_chunks();
+}
+
+#if defined(RAJA_ENABLE_OPENMP)
+TEST(BasicMemPoolUnitTest, CrossThreadFree)
+{
+  test_mempool_type pool;
+
+  const int N = 10000;
+  std::vector<int*> ptrs(N, nullptr);
+  int errors = 0;
+
+#pragma omp parallel reduction(+:errors)
+  {
+#pragma omp for schedule(static)
+    for (int i = 0; i < N; ++i) {
+      ptrs[i] = pool.malloc<int>(1 + i % 64);
+      for (int j = 0; j < 1 + i % 64; ++j) {
+        ptrs[i][j] = i;
+      }
+    }
+
+    // free in a different distribution than the allocations
+#pragma omp for schedule(dynamic, 7)
+    for (int i = 0; i < N; ++i) {
+      for (int j = 0; j < 1 + i % 64; ++j) {
+        if (ptrs[i][j] != i) {
+          ++errors;
+        }
+      }
+      pool.free(ptrs[i]);
+    }
+  }
+
+  ASSERT_EQ(errors, 0);
+
+  pool.free_chunks();
+}
+#endif
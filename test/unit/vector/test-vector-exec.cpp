@@ -0,0 +1,125 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for vector_exec with forall and kernel
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <algorithm>
+#include <vector>
+
+using VectorExecTypes =
+    ::testing::Types<RAJA::VectorRegister<double, RAJA::scalar_register>,
+                     RAJA::VectorRegister<double, RAJA::sse_register>,
+                     RAJA::VectorRegister<double>,
+                     RAJA::VectorRegister<float>>;
+
+template <typename T>
+class VectorExecUnitTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE(VectorExecUnitTest, VectorExecTypes);
+
+TYPED_TEST(VectorExecUnitTest, VectorRangeSegment)
+{
+  using vector_t = TypeParam;
+  const camp::idx_t W = vector_t::s_num_elem;
+
+  for (int len = 0; len < 3 * W + 2; ++len) {
+    RAJA::TypedVectorRangeSegment<int, vector_t> seg(5, 5 + len);
+    ASSERT_EQ(seg.length(), len);
+    ASSERT_EQ(seg.size(), (len + W - 1) / W);
+    ASSERT_EQ(seg.end() - seg.begin(), seg.size());
+
+    int next = 5;
+    for (auto i : seg) {
+      ASSERT_EQ(*i, next);
+      ASSERT_EQ(i.size(), std::min<camp::idx_t>(W, 5 + len - next));
+      next += i.size();
+    }
+    ASSERT_EQ(next, 5 + len);
+  }
+}
+
+TYPED_TEST(VectorExecUnitTest, Forall)
+{
+  using vector_t = TypeParam;
+  using element_t = typename vector_t::element_type;
+  using index_t = RAJA::VectorIndex<int, vector_t>;
+
+  for (int N : {1, 7, 64, 1001}) {
+    std::vector<element_t> a(N), b(N), c(N, element_t(0));
+    std::vector<int> offsets(N);
+    for (int i = 0; i < N; ++i) {
+      a[i] = element_t(i % 13);
+      b[i] = element_t(i % 5);
+      offsets[i] = (i * 7) % N;
+    }
+    element_t* pc = c.data();
+    const element_t* pa = a.data();
+    const element_t* pb = b.data();
+    const int* poff = offsets.data();
+
+    element_t dot = 0;
+    RAJA::forall<RAJA::vector_exec<vector_t>>(
+        RAJA::TypedRangeSegment<int>(0, N), [&](index_t i) {
+          vector_t x = i.load(pa);
+          vector_t y = i.gather(pb, poff);
+          i.store(pc, x.fused_multiply_add(y, vector_t(element_t(1))));
+          dot += x.dot(y);
+        });
+
+    element_t ref = 0;
+    for (int i = 0; i < N; ++i) {
+      ASSERT_EQ(c[i], a[i] * b[offsets[i]] + element_t(1));
+      ref += a[i] * b[offsets[i]];
+    }
+    ASSERT_EQ(dot, ref);
+  }
+}
+
+TYPED_TEST(VectorExecUnitTest, Kernel)
+{
+  using vector_t = TypeParam;
+  using element_t = typename vector_t::element_type;
+  using index_t = RAJA::VectorIndex<int, vector_t>;
+
+  const int Ni = 5;
+  const int Nj = 37;
+  std::vector<element_t> a(Ni * Nj), c(Ni * Nj, element_t(0));
+  for (int i = 0; i < Ni * Nj; ++i) {
+    a[i] = element_t(i % 11);
+  }
+  element_t* pc = c.data();
+  const element_t* pa = a.data();
+
+  using POLICY = RAJA::KernelPolicy<RAJA::statement::For<
+      0,
+      RAJA::loop_exec,
+      RAJA::statement::For<1,
+                           RAJA::vector_exec<vector_t>,
+                           RAJA::statement::Lambda<0>>>>;
+
+  RAJA::kernel<POLICY>(
+      RAJA::make_tuple(RAJA::TypedRangeSegment<int>(0, Ni),
+                       RAJA::TypedVectorRangeSegment<int, vector_t>(0, Nj)),
+      [=](int i, index_t j) {
+        // y reads a down a column, with stride Ni
+        vector_t x = j.load(pa + i * Nj);
+        vector_t y = j.load_strided(pa + i, Ni);
+        j.store(pc + i * Nj, x.fused_multiply_add(vector_t(element_t(2)), y));
+      });
+
+  for (int i = 0; i < Ni; ++i) {
+    for (int j = 0; j < Nj; ++j) {
+      ASSERT_EQ(c[i * Nj + j], 2 * a[i * Nj + j] + a[i + j * Ni]);
+    }
+  }
+}
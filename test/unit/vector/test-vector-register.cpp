@@ -0,0 +1,215 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Source file containing unit tests for VectorRegister
+///
+
+#include "RAJA_test-base.hpp"
+
+#include <algorithm>
+#include <vector>
+
+using VectorRegisterTypes =
+    ::testing::Types<RAJA::VectorRegister<double, RAJA::scalar_register>,
+                     RAJA::VectorRegister<double, RAJA::sse_register>,
+                     RAJA::VectorRegister<double, RAJA::avx_register>,
+                     RAJA::VectorRegister<double, RAJA::avx2_register>,
+                     RAJA::VectorRegister<double, RAJA::avx512_register>,
+                     RAJA::VectorRegister<float, RAJA::avx2_register>,
+                     RAJA::VectorRegister<float, RAJA::avx512_register>,
+                     RAJA::VectorRegister<int, RAJA::avx2_register>,
+                     RAJA::VectorRegister<double>,
+                     RAJA::VectorRegister<float>>;
+
+template <typename T>
+class VectorRegisterUnitTest : public ::testing::Test
+{
+};
+
+TYPED_TEST_SUITE(VectorRegisterUnitTest, VectorRegisterTypes);
+
+TYPED_TEST(VectorRegisterUnitTest, LoadStore)
+{
+  using vector_t = TypeParam;
+  using element_t = typename vector_t::element_type;
+  const camp::idx_t W = vector_t::s_num_elem;
+
+  std::vector<element_t> a(2 * W), b(2 * W, element_t(0));
+  for (camp::idx_t i = 0; i < 2 * W; ++i) {
+    a[i] = element_t(i + 1);
+  }
+
+  vector_t x;
+  x.load_packed(a.data());
+  for (camp::idx_t i = 0; i < W; ++i) {
+    ASSERT_EQ(x.get(i), a[i]);
+  }
+  x.store_packed(b.data());
+  for (camp::idx_t i = 0; i < W; ++i) {
+    ASSERT_EQ(b[i], a[i]);
+  }
+
+  x.load_strided(a.data(), 2);
+  for (camp::idx_t i = 0; i < W; ++i) {
+    ASSERT_EQ(x.get(i), a[2 * i]);
+  }
+  std::fill(b.begin(), b.end(), element_t(0));
+  x.store_strided(b.data(), 2);
+  for (camp::idx_t i = 0; i < W; ++i) {
+    ASSERT_EQ(b[2 * i], a[2 * i]);
+    ASSERT_EQ(b[2 * i + 1], element_t(0));
+  }
+}
+
+TYPED_TEST(VectorRegisterUnitTest, PartialLoadStore)
+{
+  using vector_t = TypeParam;
+  using element_t = typename vector_t::element_type;
+  const camp::idx_t W = vector_t::s_num_elem;
+
+  std::vector<element_t> a(2 * W);
+  for (camp::idx_t i = 0; i < 2 * W; ++i) {
+    a[i] = element_t(i + 1);
+  }
+
+  for (camp::idx_t n = 1; n <= W; ++n) {
+    vector_t x;
+    x.load_packed_n(a.data(), n);
+    for (camp::idx_t i = 0; i < W; ++i) {
+      ASSERT_EQ(x.get(i), i < n ? a[i] : element_t(0));
+    }
+
+    x.load_strided_n(a.data(), 2, n);
+    for (camp::idx_t i = 0; i < W; ++i) {
+      ASSERT_EQ(x.get(i), i < n ? a[2 * i] : element_t(0));
+    }
+
+    // stores must not touch memory past the first n lanes
+    std::vector<element_t> b(2 * W, element_t(-1));
+    vector_t(element_t(7)).store_packed_n(b.data(), n);
+    for (camp::idx_t i = 0; i < 2 * W; ++i) {
+      ASSERT_EQ(b[i], i < n ? element_t(7) : element_t(-1));
+    }
+
+    std::fill(b.begin(), b.end(), element_t(-1));
+    vector_t(element_t(7)).store_strided_n(b.data(), 2, n);
+    for (camp::idx_t i = 0; i < 2 * W; ++i) {
+      ASSERT_EQ(b[i], (i % 2 == 0 && i / 2 < n) ? element_t(7) : element_t(-1));
+    }
+  }
+}
+
+TYPED_TEST(VectorRegisterUnitTest, Gather)
+{
+  using vector_t = TypeParam;
+  using element_t = typename vector_t::element_type;
+  const camp::idx_t W = vector_t::s_num_elem;
+
+  const int N = 97;
+  std::vector<element_t> a(N);
+  std::vector<int> offsets(W);
+  std::vector<long> long_offsets(W);
+  for (int i = 0; i < N; ++i) {
+    a[i] = element_t(3 * i);
+  }
+  for (camp::idx_t i = 0; i < W; ++i) {
+    offsets[i] = static_cast<int>((i * 37) % N);
+    long_offsets[i] = offsets[i];
+  }
+
+  vector_t x;
+  x.gather(a.data(), offsets.data());
+  for (camp::idx_t i = 0; i < W; ++i) {
+    ASSERT_EQ(x.get(i), a[offsets[i]]);
+  }
+
+  x.gather(a.data(), long_offsets.data());
+  for (camp::idx_t i = 0; i < W; ++i) {
+    ASSERT_EQ(x.get(i), a[long_offsets[i]]);
+  }
+
+  for (camp::idx_t n = 1; n <= W; ++n) {
+    x.gather_n(a.data(), offsets.data(), n);
+    for (camp::idx_t i = 0; i < W; ++i) {
+      ASSERT_EQ(x.get(i), i < n ? a[offsets[i]] : element_t(0));
+    }
+  }
+}
+
+TYPED_TEST(VectorRegisterUnitTest, Arithmetic)
+{
+  using vector_t = TypeParam;
+  using element_t = typename vector_t::element_type;
+  const camp::idx_t W = vector_t::s_num_elem;
+
+  vector_t x, y;
+  for (camp::idx_t i = 0; i < W; ++i) {
+    x.set(i, element_t(i + 2));
+    y.set(i, element_t(2 * i + 1));
+  }
+
+  vector_t sum = x + y;
+  vector_t diff = x - y;
+  vector_t prod = x * y;
+  vector_t quot = (x * y) / y;
+  vector_t fma = x.fused_multiply_add(y, vector_t(element_t(3)));
+  vector_t neg = -x;
+  vector_t lo = x.vmin(y);
+  vector_t hi = x.vmax(y);
+  for (camp::idx_t i = 0; i < W; ++i) {
+    ASSERT_EQ(sum.get(i), x.get(i) + y.get(i));
+    ASSERT_EQ(diff.get(i), x.get(i) - y.get(i));
+    ASSERT_EQ(prod.get(i), x.get(i) * y.get(i));
+    ASSERT_EQ(quot.get(i), x.get(i));
+    ASSERT_EQ(fma.get(i), x.get(i) * y.get(i) + element_t(3));
+    ASSERT_EQ(neg.get(i), -x.get(i));
+    ASSERT_EQ(lo.get(i), std::min(x.get(i), y.get(i)));
+    ASSERT_EQ(hi.get(i), std::max(x.get(i), y.get(i)));
+  }
+
+  vector_t acc(element_t(1));
+  acc += x;
+  acc *= vector_t(element_t(2));
+  acc -= x;
+  for (camp::idx_t i = 0; i < W; ++i) {
+    ASSERT_EQ(acc.get(i), x.get(i) + element_t(2));
+  }
+}
+
+TYPED_TEST(VectorRegisterUnitTest, Reductions)
+{
+  using vector_t = TypeParam;
+  using element_t = typename vector_t::element_type;
+  const camp::idx_t W = vector_t::s_num_elem;
+
+  vector_t x;
+  element_t sum = 0;
+  element_t dot = 0;
+  for (camp::idx_t i = 0; i < W; ++i) {
+    element_t value = element_t((i * 5) % 7 + 1);
+    x.set(i, value);
+    sum += value;
+    dot += value * value;
+  }
+
+  ASSERT_EQ(x.sum(), sum);
+  ASSERT_EQ(x.dot(x), dot);
+
+  for (camp::idx_t n = 1; n <= W; ++n) {
+    element_t lo = x.get(0);
+    element_t hi = x.get(0);
+    for (camp::idx_t i = 1; i < n; ++i) {
+      lo = std::min(lo, x.get(i));
+      hi = std::max(hi, x.get(i));
+    }
+    ASSERT_EQ(x.min_n(n), lo);
+    ASSERT_EQ(x.max_n(n), hi);
+  }
+  ASSERT_EQ(x.min(), x.min_n(W));
+  ASSERT_EQ(x.max(), x.max_n(W));
+}
@@ -0,0 +1,140 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2016-21, Lawrence Livermore National Security, LLC
+// and RAJA project contributors. See the RAJA/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RAJA_test-base.hpp"
+#include "RAJA_unit-test-types.hpp"
+
+#include <limits>
+
+template<typename T>
+class FastDivLayoutUnitTest : public ::testing::Test {};
+
+TYPED_TEST_SUITE(FastDivLayoutUnitTest, UnitIndexTypes);
+
+
+TYPED_TEST(FastDivLayoutUnitTest, FastDivisor)
+{
+  using T = TypeParam;
+
+  const T max_n = std::numeric_limits<T>::max();
+
+  for (T d = 1; d < 40; ++d) {
+    const RAJA::FastDivisor<T> fd(d);
+
+    for (T n = 0; n < 200 && n < max_n; ++n) {
+      ASSERT_EQ(T(n / d), fd.div(n));
+      ASSERT_EQ(T(n % d), fd.mod(n));
+    }
+
+    // numerators near the top of the range
+    for (T n = max_n; n > max_n - 200 && n > 0; --n) {
+      T q, r;
+      fd.divmod(n, q, r);
+      ASSERT_EQ(T(n / d), q);
+      ASSERT_EQ(T(n % d), r);
+    }
+  }
+
+  const RAJA::FastDivisor<T> by_max(max_n);
+  ASSERT_EQ(T(1), by_max.div(max_n));
+  ASSERT_EQ(T(0), by_max.div(T(max_n - 1)));
+
+  const RAJA::FastDivisor<T> by_one;
+  ASSERT_EQ(max_n, by_one.div(max_n));
+}
+
+TYPED_TEST(FastDivLayoutUnitTest, 3D_toIndices)
+{
+  const RAJA::Layout<3, TypeParam> layout(3, 5, 7);
+  const RAJA::FastDivLayout<3, TypeParam> fast(3, 5, 7);
+
+  for (TypeParam k = 0; k < TypeParam(3 * 5 * 7); ++k) {
+    TypeParam i, j, l, fi, fj, fl;
+    layout.toIndices(k, i, j, l);
+    fast.toIndices(k, fi, fj, fl);
+
+    ASSERT_EQ(i, fi);
+    ASSERT_EQ(j, fj);
+    ASSERT_EQ(l, fl);
+    ASSERT_EQ(k, fast(fi, fj, fl));
+  }
+}
+
+TYPED_TEST(FastDivLayoutUnitTest, Projected_toIndices)
+{
+  // a zero sized dimension is projected out and always maps to 0
+  const RAJA::Layout<3, TypeParam> layout(4, 0, 9);
+  const RAJA::FastDivLayout<3, TypeParam> fast(4, 0, 9);
+
+  for (TypeParam k = 0; k < TypeParam(4 * 9); ++k) {
+    TypeParam i, j, l, fi, fj, fl;
+    layout.toIndices(k, i, j, l);
+    fast.toIndices(k, fi, fj, fl);
+
+    ASSERT_EQ(i, fi);
+    ASSERT_EQ(TypeParam(0), fj);
+    ASSERT_EQ(l, fl);
+  }
+}
+
+TEST(FastDivLayoutTest, Permuted_toIndices)
+{
+  const auto layout =
+      RAJA::make_permuted_layout({{3, 5, 7}},
+                                 RAJA::as_array<RAJA::PERM_JKI>::get());
+  const RAJA::FastDivLayout<3> fast(layout);
+
+  for (RAJA::Index_type k = 0; k < 3 * 5 * 7; ++k) {
+    RAJA::Index_type i, j, l, fi, fj, fl;
+    layout.toIndices(k, i, j, l);
+    fast.toIndices(k, fi, fj, fl);
+
+    ASSERT_EQ(i, fi);
+    ASSERT_EQ(j, fj);
+    ASSERT_EQ(l, fl);
+    ASSERT_EQ(k, fast(fi, fj, fl));
+  }
+}
+
+TEST(FastDivLayoutTest, TypedFastDivLayout)
+{
+  using TIL = RAJA::Index_type;
+  using TIX = RAJA::Index_type;
+  using TIY = RAJA::Index_type;
+
+  const RAJA::TypedFastDivLayout<TIL, RAJA::tuple<TIX, TIY>> l(10, 5);
+
+  ASSERT_EQ(TIL{10}, l(TIX{2}, TIY{0}));
+
+  TIX x{5};
+  TIY y{0};
+  l.toIndices(TIL{13}, x, y);
+  ASSERT_EQ(x, TIX{2});
+  ASSERT_EQ(y, TIY{3});
+}
+
+TEST(FastDivLayoutTest, OffsetLayout_toIndices)
+{
+  const auto layout = RAJA::make_offset_layout<2>({{-1, 2}}, {{4, 9}});
+  const RAJA::FastDivOffsetLayout<2> fast(layout);
+
+  RAJA::Index_type k = 0;
+  for (RAJA::Index_type i = -1; i <= 4; ++i) {
+    for (RAJA::Index_type j = 2; j <= 9; ++j) {
+      RAJA::Index_type ri, rj, fi, fj;
+      layout.toIndices(k, ri, rj);
+      fast.toIndices(k, fi, fj);
+
+      ASSERT_EQ(i, ri);
+      ASSERT_EQ(j, rj);
+      ASSERT_EQ(i, fi);
+      ASSERT_EQ(j, fj);
+      ASSERT_EQ(k, fast(fi, fj));
+      ++k;
+    }
+  }
+}